@@ -39,11 +39,64 @@ unsigned lsm6ds33_read_reg(unsigned char reg) {
 	return uc;
 }
 
+// bits of the control registers
+#define CTRL2_G_FS_125          0x02
+#define CTRL3_C_BDU             0x40 // output registers update only once both bytes are read
+#define CTRL3_C_IF_INC          0x04 // default on
+#define CTRL4_C_XL_BW_SCAL_ODR  0x80 // the accelerometer filter is set by BW_XL, not the ODR
+#define CTRL6_C_XL_HM_MODE      0x10 // accelerometer high performance off
+#define CTRL7_G_G_HM_MODE       0x80 // gyroscope high performance off
+
 void lsm6ds33_init() {
 	lsm6ds33_write_reg(CTRL2_G, 0x80);   // 1600Hz (high perf mode)
-  printf("write 1 success");
 	lsm6ds33_write_reg(CTRL1_XL, 0x80);  // 1600Hz (high perf mode)
-  printf("write 2 success");
+}
+
+void lsm6ds33_configure(const lsm6ds33_config_t *config) {
+	const lsm6ds33_sensor_config_t *xl = &config->accel, *g = &config->gyro;
+
+	lsm6ds33_write_reg(CTRL3_C, CTRL3_C_BDU | CTRL3_C_IF_INC);
+
+	// power modes before rates, so a sensor starts in the mode it runs in
+	lsm6ds33_write_reg(CTRL6_C, (xl->power == LSM6DS33_LOW_POWER) ? CTRL6_C_XL_HM_MODE : 0);
+	lsm6ds33_write_reg(CTRL7_G, (g->power == LSM6DS33_LOW_POWER) ? CTRL7_G_G_HM_MODE : 0);
+
+	unsigned char bw = (xl->bandwidth == LSM6DS33_BW_AUTO) ? 0 : xl->bandwidth;
+	lsm6ds33_write_reg(CTRL4_C, (xl->bandwidth == LSM6DS33_BW_AUTO) ? 0 : CTRL4_C_XL_BW_SCAL_ODR);
+	lsm6ds33_write_reg(CTRL1_XL, (xl->odr << 4) | (xl->scale << 2) | bw);
+	if (g->scale == LSM6DS33_GYRO_125DPS)
+		lsm6ds33_write_reg(CTRL2_G, (g->odr << 4) | CTRL2_G_FS_125);
+	else
+		lsm6ds33_write_reg(CTRL2_G, (g->odr << 4) | (g->scale << 2));
+
+	lsm6ds33_write_reg(CTRL9_XL, xl->axes & LSM6DS33_AXIS_ALL);
+	lsm6ds33_write_reg(CTRL10_C, g->axes & LSM6DS33_AXIS_ALL);
+}
+
+lsm6ds33_config_t lsm6ds33_config_for_rate(unsigned int hz) {
+	// the slowest rate that samples at least twice per read; the ODR codes
+	// go 12.5Hz, then double each step
+	lsm6ds33_odr_t odr = LSM6DS33_ODR_12_5HZ;
+	unsigned int odr_x2 = 25; // twice the rate of odr, to stay in whole numbers
+	while (odr_x2 < 4 * hz && odr < LSM6DS33_ODR_1660HZ) {
+		odr++;
+		odr_x2 *= 2;
+	}
+
+	// the narrowest anti-aliasing filter that still passes hz / 2
+	lsm6ds33_bandwidth_t bw = LSM6DS33_BW_50HZ;
+	unsigned int cutoff = 50;
+	while (cutoff < hz / 2 && bw > LSM6DS33_BW_400HZ) {
+		bw--;
+		cutoff *= 2;
+	}
+
+	lsm6ds33_power_t power = (odr <= LSM6DS33_ODR_208HZ) ? LSM6DS33_LOW_POWER : LSM6DS33_HIGH_PERFORMANCE;
+	lsm6ds33_config_t config = {
+		{ odr, LSM6DS33_ACCEL_2G, bw, power, LSM6DS33_AXIS_ALL },
+		{ odr, LSM6DS33_GYRO_245DPS, LSM6DS33_BW_AUTO, power, LSM6DS33_AXIS_ALL },
+	};
+	return config;
 }
 
 unsigned lsm6ds33_get_whoami() {
@@ -79,8 +79,93 @@ enum regAddr
       MD2_CFG           = 0x5F,
 };
 
+// output data rates, for CTRL1_XL and CTRL2_G. the gyroscope stops at 1660Hz
+typedef enum
+{
+      LSM6DS33_ODR_OFF     = 0x0,
+      LSM6DS33_ODR_12_5HZ  = 0x1,
+      LSM6DS33_ODR_26HZ    = 0x2,
+      LSM6DS33_ODR_52HZ    = 0x3,
+      LSM6DS33_ODR_104HZ   = 0x4,
+      LSM6DS33_ODR_208HZ   = 0x5,
+      LSM6DS33_ODR_416HZ   = 0x6,
+      LSM6DS33_ODR_833HZ   = 0x7,
+      LSM6DS33_ODR_1660HZ  = 0x8,
+      LSM6DS33_ODR_3330HZ  = 0x9,
+      LSM6DS33_ODR_6660HZ  = 0xA,
+} lsm6ds33_odr_t;
+
+// accelerometer full scale; 2g counts 0.061 mg
+typedef enum
+{
+      LSM6DS33_ACCEL_2G    = 0x0,
+      LSM6DS33_ACCEL_16G   = 0x1,
+      LSM6DS33_ACCEL_4G    = 0x2,
+      LSM6DS33_ACCEL_8G    = 0x3,
+} lsm6ds33_accel_scale_t;
+
+// gyroscope full scale; 245 dps counts 8.75 mdps
+typedef enum
+{
+      LSM6DS33_GYRO_245DPS  = 0x0,
+      LSM6DS33_GYRO_500DPS  = 0x1,
+      LSM6DS33_GYRO_1000DPS = 0x2,
+      LSM6DS33_GYRO_2000DPS = 0x3,
+      LSM6DS33_GYRO_125DPS  = 0x4,
+} lsm6ds33_gyro_scale_t;
+
+// accelerometer anti-aliasing filter; AUTO lets the ODR choose it
+typedef enum
+{
+      LSM6DS33_BW_400HZ    = 0x0,
+      LSM6DS33_BW_200HZ    = 0x1,
+      LSM6DS33_BW_100HZ    = 0x2,
+      LSM6DS33_BW_50HZ     = 0x3,
+      LSM6DS33_BW_AUTO     = 0x4,
+} lsm6ds33_bandwidth_t;
+
+// high performance is quietest; otherwise ODRs up to 52Hz are low power
+// and 104-208Hz are normal mode
+typedef enum
+{
+      LSM6DS33_HIGH_PERFORMANCE,
+      LSM6DS33_LOW_POWER,
+} lsm6ds33_power_t;
+
+// axis enables, for CTRL9_XL and CTRL10_C
+#define LSM6DS33_AXIS_X    0x08
+#define LSM6DS33_AXIS_Y    0x10
+#define LSM6DS33_AXIS_Z    0x20
+#define LSM6DS33_AXIS_ALL  0x38
+
+typedef struct
+{
+      lsm6ds33_odr_t odr;          // LSM6DS33_ODR_OFF powers the sensor down
+      int scale;                   // an lsm6ds33_accel_scale_t or lsm6ds33_gyro_scale_t
+      lsm6ds33_bandwidth_t bandwidth; // accelerometer only
+      lsm6ds33_power_t power;
+      unsigned char axes;          // LSM6DS33_AXIS_ bits
+} lsm6ds33_sensor_config_t;
+
+typedef struct
+{
+      lsm6ds33_sensor_config_t accel;
+      lsm6ds33_sensor_config_t gyro;
+} lsm6ds33_config_t;
+
+// both sensors at 1660Hz, high performance, default scales, all axes
 void lsm6ds33_init();
 
+// apply a configuration to both sensors. register reads are made
+// consistent (block data update), so a sample is never half old, half new
+void lsm6ds33_configure(const lsm6ds33_config_t *config);
+
+// settings for reading samples hz times a second, such as once per frame:
+// the slowest ODR at least twice hz, the narrowest accelerometer filter
+// that passes hz / 2, low power where the ODR allows, the most sensitive
+// scales and all axes
+lsm6ds33_config_t lsm6ds33_config_for_rate(unsigned int hz);
+
 void lsm6ds33_write_reg(unsigned char reg, unsigned char v);
 unsigned lsm6ds33_read_reg(unsigned char reg);
 
@@ -2,9 +2,23 @@
 #include "uart.h"
 #include "i2c.h"
 #include "accel.h"
+#include "trig.h"
 #include "printf.h"
 
 #include "LSM6DS33.h"
+#include <stdbool.h>
+
+// how long the accelerometer takes to pull the roll to where it says;
+// shorter follows gravity sooner, longer filters out more of its noise
+#define ROLL_TIME_CONSTANT_US 500000
+#define MAX_STEP_US 65535 // a longer gap is taken as this long
+
+// the game reads the sensors once per frame
+#define READS_PER_SECOND 60
+
+static fix_t roll;
+static unsigned int last_ticks;
+static bool rolling;
 
 void accel_init(void) {
 
@@ -12,11 +26,19 @@ void accel_init(void) {
 	uart_init();
 
     i2c_init();
+    i2c_set_speed(I2C_FAST_MODE); // the LSM6DS33 handles 400kHz
 	lsm6ds33_init();
     //printf("lsm");
 
     //printf("whoami=%x\n", lsm6ds33_get_whoami());
 
+    // sample no faster than the reads need, and only the gyroscope axis
+    // accel_roll uses
+    lsm6ds33_config_t config = lsm6ds33_config_for_rate(READS_PER_SECOND);
+    config.gyro.axes = LSM6DS33_AXIS_Y;
+    lsm6ds33_configure(&config);
+
+    rolling = false;
 }
 
 short accel_vals(void){
@@ -27,3 +49,42 @@ short accel_vals(void){
     //printf("accel=(%dmg,%dmg,%dmg)\n", x/16, y/16, z/16);
     return x/16;
 }
+
+/* the roll for an accelerometer reading; see accel_tilt_angle */
+static fix_t gravity_roll(short x, short y, short z) {
+    unsigned int level = trig_isqrt((unsigned int)(y * y) + (unsigned int)(z * z)); // gravity across the x axis
+    return trig_atan2(x, level);
+}
+
+fix_t accel_tilt_angle(void) {
+    short x, y, z;
+    lsm6ds33_read_accelerometer(&x, &y, &z);
+    return gravity_roll(x, y, z);
+}
+
+fix_t accel_roll(fix_t *rate) {
+    short x, y, z, gx, gy, gz;
+    lsm6ds33_read_gyroscope(&gx, &gy, &gz);
+    lsm6ds33_read_accelerometer(&x, &y, &z);
+    unsigned int now = timer_get_ticks();
+
+    // at the default 245 dps full scale the gyroscope counts 8.75 mdps.
+    // rolling right turns the controller backwards about y
+    fix_t roll_rate = (-gy * 1147) >> 1;
+    if (rate)
+        *rate = roll_rate;
+
+    if (!rolling) {
+        roll = gravity_roll(x, y, z);
+        rolling = true;
+    } else {
+        unsigned int dt = now - last_ticks;
+        if (dt > MAX_STEP_US)
+            dt = MAX_STEP_US;
+        fix_t seconds = (dt * 4295) >> 16; // 2^16 / 10^6 = 0.065536
+        fix_t weight = (dt << 16) / (ROLL_TIME_CONSTANT_US + dt);
+        roll = fix_lerp(roll + fix_mul(roll_rate, seconds), gravity_roll(x, y, z), weight);
+    }
+    last_ticks = now;
+    return roll;
+}
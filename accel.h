@@ -1,8 +1,37 @@
 #ifndef ACCEL_H
 #define ACCEL_H
 
+#include "fixed.h"
 
 void accel_init(void);
 short accel_vals(void);
 
-#endif
\ No newline at end of file
+/*
+ * `accel_tilt_angle`
+ *
+ * Read the accelerometer and work out the roll from gravity alone: the
+ * angle between the x axis and the plane of y and z. It does not depend
+ * on how far the controller is tipped forward or back.
+ *
+ * @return  the roll in degrees, -90 to 90, positive to the right
+ */
+fix_t accel_tilt_angle(void);
+
+/*
+ * `accel_roll`
+ *
+ * Read the gyroscope and the accelerometer and fuse them into the roll
+ * of the controller, its tilt to the left or right.
+ *
+ * The gyroscope rate is integrated for a quick, smooth response; it
+ * drifts over time. The accelerometer angle pulls the result slowly
+ * toward `accel_tilt_angle`, so it does not drift, but its noise
+ * is mostly filtered out (a complementary filter). The first call
+ * starts from the accelerometer angle alone.
+ *
+ * @param rate  set to the rate of roll in degrees per second, if not NULL
+ * @return      the roll in degrees, positive to the right
+ */
+fix_t accel_roll(fix_t *rate);
+
+#endif
@@ -0,0 +1,244 @@
+#include "anim.h"
+#include "assert.h"
+#include "malloc.h"
+#include <stddef.h>
+
+struct anim_player {
+	const anim_t *anim;
+	unsigned int frame;
+	unsigned short width, height; // the largest frames the buffers below hold
+
+	// the current frame: a copy of the first sprite on frame 0, else
+	// decoded untrimmed into the buffers below, which follow the player
+	// in the same allocation
+	gl_sprite_t sprite;
+	unsigned int *mask;           // height words
+	unsigned short *rows;         // height + 1
+	gl_span_t *spans;             // at most (width + 1) / 2 per row
+	unsigned char *indices;       // (width + 1) / 2 bytes per row
+
+	// what `anim_update` last left in each of up to two buffers
+	struct anim_drawn {
+		const color_t *pixels;    // the buffer, NULL if none
+		const anim_t *anim;
+		unsigned int frame;
+		int x, y, scale;
+	} drawn[2];
+	unsigned int last_drawn;
+};
+
+static inline unsigned int get_index(const unsigned char *row, int x)
+{
+	return (row[x >> 1] >> ((x & 1) * 4)) & 0xf;
+}
+
+static inline void set_index(unsigned char *row, int x, unsigned int index)
+{
+	int shift = (x & 1) * 4;
+	row[x >> 1] = (row[x >> 1] & ~(0xf << shift)) | (index << shift);
+}
+
+/* rebuilds the spans of the decoded frame from its mask, so the sprite
+   can be drawn the same way as the generated ones */
+static void build_spans(anim_player_t *p)
+{
+	int n = 0;
+	for (int y = 0; y < p->sprite.height; y++) {
+		p->rows[y] = n;
+		unsigned int bits = p->mask[y];
+		int x = 0;
+		while (bits) {
+			while (!(bits & 1)) {
+				bits >>= 1;
+				x++;
+			}
+			int start = x;
+			while (bits & 1) {
+				bits >>= 1;
+				x++;
+			}
+			p->spans[n].x = start;
+			p->spans[n].len = x - start;
+			n++;
+		}
+	}
+	p->rows[p->sprite.height] = n;
+}
+
+/* unpacks frame 0 of the animation out of its trimmed sprite, so that
+   deltas can be applied to it */
+static void decode_first(anim_player_t *p)
+{
+	const gl_sprite_t *img = p->anim->first;
+
+	int stride = (img->width + 1) / 2;
+	for (int i = 0; i < img->height * stride; i++)
+		p->indices[i] = 0;
+	for (int y = 0; y < img->height; y++)
+		p->mask[y] = 0;
+
+	for (int y = 0; y < img->trim_h; y++) {
+		const unsigned char *src = img->indices + y * img->stride;
+		unsigned char *dst = p->indices + (img->trim_y + y) * stride;
+		for (int x = 0; x < img->trim_w; x++)
+			set_index(dst, img->trim_x + x, get_index(src, x));
+		p->mask[img->trim_y + y] = img->mask[y] << img->trim_x;
+	}
+
+	// same image, pivot and collider, but untrimmed and not compiled
+	p->sprite = *img;
+	p->sprite.trim_x = p->sprite.trim_y = 0;
+	p->sprite.trim_w = img->width;
+	p->sprite.trim_h = img->height;
+	p->sprite.indices = p->indices;
+	p->sprite.stride = stride;
+	p->sprite.rows = p->rows;
+	p->sprite.spans = p->spans;
+	p->sprite.mask = p->mask;
+	p->sprite.compiled = NULL;
+	build_spans(p);
+}
+
+/* applies delta d to the decoded frame */
+static void apply_delta(anim_player_t *p, const anim_delta_t *d)
+{
+	int stride = p->sprite.stride;
+	int n = 0;
+	for (int i = 0; i < d->count; i++) {
+		const anim_run_t *run = &d->runs[i];
+		unsigned char *row = p->indices + run->y * stride;
+		for (int x = run->x; x < run->x + run->len; x++, n++) {
+			unsigned int index = get_index(d->indices, n);
+			set_index(row, x, index);
+			if (index)
+				p->mask[run->y] |= 1u << x;
+			else
+				p->mask[run->y] &= ~(1u << x);
+		}
+	}
+	build_spans(p);
+}
+
+/* draws the pixels changed by delta d into the target, merging neighbors
+   of the same color into one rectangle */
+static void draw_delta(const anim_player_t *p, const anim_delta_t *d, int x, int y, int scale,
+                       color_t background)
+{
+	const color_t *palette = p->anim->first->palette;
+	int n = 0;
+	for (int i = 0; i < d->count; i++) {
+		const anim_run_t *run = &d->runs[i];
+		int end = n + run->len;
+		int left = x + run->x * scale;
+		while (n < end) {
+			unsigned int index = get_index(d->indices, n);
+			int count = 1;
+			while (n + count < end && get_index(d->indices, n + count) == index)
+				count++;
+			color_t c = index ? palette[index] : background;
+			gl_draw_rect(left, y + run->y * scale, count * scale, scale, c);
+			left += count * scale;
+			n += count;
+		}
+	}
+}
+
+anim_player_t *anim_player_new(const anim_t *anim)
+{
+	int width = anim->first->width, height = anim->first->height;
+	assert(width <= ANIM_MAX_WIDTH);
+	int half = (width + 1) / 2;
+	anim_player_t *p = malloc(sizeof(anim_player_t)
+	                          + height * sizeof(unsigned int)
+	                          + (height + 1) * sizeof(unsigned short)
+	                          + height * half * sizeof(gl_span_t)
+	                          + height * half);
+	if (!p)
+		return NULL;
+	p->width = width;
+	p->height = height;
+	// the buffers in order of alignment, largest first
+	p->mask = (unsigned int *)(p + 1);
+	p->rows = (unsigned short *)(p->mask + height);
+	p->spans = (gl_span_t *)(p->rows + height + 1);
+	p->indices = (unsigned char *)(p->spans + height * half);
+	for (int i = 0; i < 2; i++)
+		p->drawn[i].pixels = NULL;
+	p->last_drawn = 0;
+	anim_play(p, anim);
+	return p;
+}
+
+void anim_player_free(anim_player_t *p)
+{
+	free(p);
+}
+
+void anim_play(anim_player_t *p, const anim_t *anim)
+{
+	assert(anim->first->width <= p->width && anim->first->height <= p->height);
+	// frame 0 is drawn straight from the generated sprite, compiled code
+	// and all; it is only decoded once the player moves past it
+	p->anim = anim;
+	p->frame = 0;
+	p->sprite = *anim->first;
+}
+
+bool anim_next(anim_player_t *p)
+{
+	unsigned int next = p->frame + 1;
+	if (next == p->anim->frames) {
+		if (!p->anim->loop)
+			return false;
+		next = 0;
+	}
+	if (next == 0) {
+		p->sprite = *p->anim->first;
+	} else {
+		if (p->frame == 0)
+			decode_first(p);
+		apply_delta(p, &p->anim->deltas[p->frame]);
+	}
+	p->frame = next;
+	return true;
+}
+
+const gl_sprite_t *anim_sprite(const anim_player_t *p)
+{
+	return &p->sprite;
+}
+
+void anim_update(anim_player_t *p, int x, int y, int scale, color_t background)
+{
+	const color_t *pixels = gl_get_target()->pixels;
+	unsigned int slot;
+	if (p->drawn[0].pixels == pixels)
+		slot = 0;
+	else if (p->drawn[1].pixels == pixels)
+		slot = 1;
+	else
+		slot = !p->last_drawn; // a buffer not seen before replaces the older one
+	p->last_drawn = slot;
+
+	struct anim_drawn *was = &p->drawn[slot];
+	bool known = was->pixels == pixels;
+	if (known && was->anim == p->anim && was->x == x && was->y == y && was->scale == scale
+		&& (p->anim->loop || was->frame <= p->frame)) {
+		// replay the deltas between the frame left in this buffer and now
+		for (unsigned int f = was->frame; f != p->frame; f = (f + 1 == p->anim->frames) ? 0 : f + 1)
+			draw_delta(p, &p->anim->deltas[f], x, y, scale, background);
+	} else {
+		if (known)
+			gl_draw_rect(was->x, was->y, was->anim->first->width * was->scale,
+			             was->anim->first->height * was->scale, background);
+		gl_draw_rect(x, y, p->sprite.width * scale, p->sprite.height * scale, background);
+		gl_draw_img(x, y, &p->sprite, scale);
+	}
+
+	was->pixels = pixels;
+	was->anim = p->anim;
+	was->frame = p->frame;
+	was->x = x;
+	was->y = y;
+	was->scale = scale;
+}
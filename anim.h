@@ -0,0 +1,134 @@
+#ifndef ANIM_H
+#define ANIM_H
+
+/*
+ * Delta-encoded sprite animations and a player that steps through them.
+ *
+ * An animation keeps only its first frame as a full sprite. Every later
+ * frame is stored as the runs of pixels that changed since the frame
+ * before, so frames that differ in a few pixels cost a few bytes. The
+ * animations are written by tools/spritegen.py from art/anims.txt.
+ *
+ * A player tracks the current frame of one object and keeps that frame
+ * as a sprite, decoding the later frames as it steps through them. Its
+ * decode buffers are sized for the animation it is created with.
+ * `anim_update` redraws a player in place: when the sprite has not moved
+ * since it was last drawn into the same buffer, only the pixels that
+ * changed since then are written.
+ */
+
+#include "gl.h"
+#include <stdbool.h>
+
+#define ANIM_MAX_WIDTH 32  // one mask word per row
+
+/*
+ * `anim_run_t`
+ *
+ * A run of len changed pixels starting at column x of row y of the image.
+ */
+typedef struct {
+	unsigned char x, y, len;
+} anim_run_t;
+
+/*
+ * `anim_delta_t`
+ *
+ * The change from one frame to the next. The new palette indices of the
+ * changed pixels follow each other in run order, two per byte with the
+ * first pixel in the low nibble. Index 0 means the pixel became
+ * transparent.
+ */
+typedef struct {
+	unsigned short count;            // number of runs
+	const anim_run_t *runs;
+	const unsigned char *indices;
+} anim_delta_t;
+
+/*
+ * `anim_t`
+ *
+ * An animation of frames images of the same size as first. deltas[i]
+ * turns frame i into frame i + 1; a looping animation has one more delta
+ * that turns the last frame back into frame 0.
+ */
+typedef struct {
+	unsigned short frames;
+	bool loop;
+	const gl_sprite_t *first;
+	const anim_delta_t *deltas;
+} anim_t;
+
+/*
+ * `anim_player_t`
+ *
+ * The state of one playing animation.
+ */
+typedef struct anim_player anim_player_t;
+
+/*
+ * `anim_player_new`
+ *
+ * Create a player on frame 0 of anim, with room to decode frames of its
+ * size. The frames are decoded only once the player moves past frame 0.
+ *
+ * @param anim  the animation to play
+ * @return      the new player, or NULL if there is not enough memory
+ */
+anim_player_t *anim_player_new(const anim_t *anim);
+
+/*
+ * `anim_player_free`
+ *
+ * Release a player created by `anim_player_new`.
+ */
+void anim_player_free(anim_player_t *p);
+
+/*
+ * `anim_play`
+ *
+ * Switch player p to frame 0 of anim, whose frames must be no larger
+ * than those of the animation the player was created with.
+ */
+void anim_play(anim_player_t *p, const anim_t *anim);
+
+/*
+ * `anim_next`
+ *
+ * Advance player p by one frame, applying the delta to the decoded
+ * sprite. A looping animation wraps around to frame 0; any other stays
+ * on its last frame.
+ *
+ * @return  false if the animation was already on its last frame and
+ *          does not loop, true otherwise
+ */
+bool anim_next(anim_player_t *p);
+
+/*
+ * `anim_sprite`
+ *
+ * The current frame of player p as a sprite, to draw with `gl_draw_img`
+ * or any of its variants. The sprite changes along with the player.
+ */
+const gl_sprite_t *anim_sprite(const anim_player_t *p);
+
+/*
+ * `anim_update`
+ *
+ * Bring the sprite of player p at x,y in the current gl target up to
+ * date, for layers that are not cleared every frame. If the player was
+ * last drawn into this buffer at the same place and scale and in the
+ * same animation, only the pixels that changed since are written, with
+ * the background color where a pixel became transparent. Otherwise the
+ * old sprite is erased to the background color and the whole box of the
+ * current frame is drawn. Up to two buffers are tracked, so this works
+ * on the double-buffered framebuffer.
+ *
+ * The incremental path assumes nothing else has drawn over the sprite
+ * in this buffer since the player last drew it there.
+ *
+ * @param background  the color of the layer behind the sprite
+ */
+void anim_update(anim_player_t *p, int x, int y, int scale, color_t background);
+
+#endif
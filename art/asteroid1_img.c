@@ -0,0 +1,57 @@
+/* GIMP RGBA C-Source image dump (asteroid1_img.c) */
+
+static const struct {
+  guint  	 width;
+  guint  	 height;
+  guint  	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
+  guint8 	 pixel_data[18 * 16 * 4 + 1];
+} asteroid1_img = {
+  18, 16, 4,
+  "\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\025\020\022\377\025\020\022\377\025\020\022"
+  "\377\025\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\334k\214\377"
+  "\334k\214\377\355\216\252\377\355\216\252\377\355\216\252\377\355\216\252"
+  "\377\025\020\022\377\025\020\022\377\025\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\334k\214\377\334k\214\377\334"
+  "k\214\377\334k\214\377\355\216\252\377\355\216\252\377\355\216\252\377\334"
+  "k\214\377\277<b\377\277<b\377\355\216\252\377\025\020\022\377\025\020\022\377\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\334k\214\377\334k\214\377\277"
+  "<b\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\355\216\252\377"
+  "\334k\214\377\334k\214\377\355\216\252\377\355\216\252\377\355\216\252\377"
+  "\025\020\022\377\000\000\000\000\000\000\000\000\025\020\022\377\334k\214\377\334k\214\377\355"
+  "\216\252\377\334k\214\377\277<b\377\277<b\377\277<b\377\277<b\377\334k\214"
+  "\377\355\216\252\377\355\216\252\377\334k\214\377\334k\214\377\355\216\252"
+  "\377\355\216\252\377\025\020\022\377\000\000\000\000\025\020\022\377\334k\214\377\355\216"
+  "\252\377\355\216\252\377\355\216\252\377\334k\214\377\277<b\377\277<b\377"
+  "\334k\214\377\334k\214\377\334k\214\377\334k\214\377\277<b\377\334k\214\377"
+  "\334k\214\377\334k\214\377\025\020\022\377\000\000\000\000\025\020\022\377\334k\214\377"
+  "\334k\214\377\334k\214\377\355\216\252\377\355\216\252\377\334k\214\377\334"
+  "k\214\377\334k\214\377\334k\214\377\355\216\252\377\355\216\252\377\334k"
+  "\214\377\277<b\377\277<b\377\334k\214\377\355\216\252\377\025\020\022\377\025"
+  "\020\022\377\277<b\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377"
+  "\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\355\216"
+  "\252\377\355\216\252\377\334k\214\377\277<b\377\334k\214\377\355\216\252"
+  "\377\025\020\022\377\000\000\000\000\025\020\022\377\334k\214\377\334k\214\377\334k\214"
+  "\377\334k\214\377\334k\214\377\277<b\377\277<b\377\334k\214\377\334k\214"
+  "\377\334k\214\377\334k\214\377\277<b\377\277<b\377\334k\214\377\355\216\252"
+  "\377\025\020\022\377\000\000\000\000\025\020\022\377\277<b\377\334k\214\377\334k\214\377"
+  "\277<b\377\277<b\377\277<b\377\277<b\377\334k\214\377\334k\214\377\334k\214"
+  "\377\334k\214\377\277<b\377\334k\214\377\334k\214\377\355\216\252\377\025"
+  "\020\022\377\000\000\000\000\000\000\000\000\025\020\022\377\277<b\377\334k\214\377\334k\214\377"
+  "\277<b\377\277<b\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377"
+  "\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\025\020\022"
+  "\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\334k\214\377\334k\214\377\334k"
+  "\214\377\334k\214\377\334k\214\377\334k\214\377\277<b\377\277<b\377\334k"
+  "\214\377\334k\214\377\334k\214\377\334k\214\377\025\020\022\377\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\025\020\022\377\277<b\377\334k\214\377\334k\214\377\334"
+  "k\214\377\334k\214\377\277<b\377\277<b\377\277<b\377\277<b\377\334k\214\377"
+  "\277<b\377\277<b\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\025\020\022\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\277<b\377"
+  "\277<b\377\334k\214\377\334k\214\377\277<b\377\025\020\022\377\025\020\022\377"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\277<b\377\277"
+  "<b\377\277<b\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\277"
+  "<b\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\025\020\022\377\025\020\022\377\025\020\022\377\025\020\022\377\025"
+  "\020\022\377\025\020\022\377\025\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000",
+};
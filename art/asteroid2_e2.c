@@ -0,0 +1,49 @@
+/* GIMP RGBA C-Source image dump (asteroid2_e2.c) */
+
+static const struct {
+  guint  	 width;
+  guint  	 height;
+  guint  	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
+  guint8 	 pixel_data[19 * 16 * 4 + 1];
+} asteroid2_e2 = {
+  19, 16, 4,
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022"
+  "\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\355\216\252\377\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\355"
+  "\216\252\377\355\216\252\377\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\355\216\252\377\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\355\216\252\377\000\000\000"
+  "\000\355\216\252\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\355\216\252\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022"
+  "\377\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\355\216\252\377\000\000\000\000\277<b\377\334k\214\377\355\216\252\377"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\277<b\377\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377"
+  "\000\000\000\000\334k\214\377\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\277<b\377\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000\334k\214\377\000\000\000"
+  "\000\025\020\022\377\025\020\022\377\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334"
+  "k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\277"
+  "<b\377\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\334k\214\377\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377"
+  "\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\025\020\022\377\334k\214\377\334k\214\377\000\000\000\000\277<b\377\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000"
+  "\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\334k\214\377"
+  "\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\025\020\022\377\025\020\022\377\000\000\000"
+  "\000\000\000\000\000\277<b\377\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\334k\214\377\025\020\022\377\025\020\022\377\000\000\000\000\025\020\022\377"
+  "\025\020\022\377\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000",
+};
@@ -0,0 +1,41 @@
+/* GIMP RGBA C-Source image dump (bug_e1.c) */
+
+static const struct {
+  guint  	 width;
+  guint  	 height;
+  guint  	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
+  guint8 	 pixel_data[19 * 11 * 4 + 1];
+} bug_e1 = {
+  19, 11, 4,
+  "\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\065\364"
+  "\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377\000\000\000\000"
+  "\000\000\000\000\065\364\065\377\065\364\065\377\065\364\065\377\065\364\065\377\065\364\065"
+  "\377\000\000\000\000\065\364\065\377B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377\065\364\065\377\025\020\022"
+  "\377\065\364\065\377\065\364\065\377\377\377\377\377\377\377\377\377\025\020\022"
+  "\377\065\364\065\377\000\000\000\000\352Y\204\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\065\364\065\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\025\020\022\377\065\364\065\377\065\364\065\377\377\377\377\377\377"
+  "\377\377\377\025\020\022\377\352Y\204\377\352Y\204\377\352Y\204\377\065\364\065"
+  "\377\000\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\315#U\377\315#U\377B\303B\377\025"
+  "\020\022\377\343\377\000\377\343\377\000\377\352Y\204\377\352Y\204\377\352Y\204"
+  "\377\343\377\000\377\065\364\065\377\000\000\000\000\035\003\371\377\035\003\371\377\035\003\371"
+  "\377\035\003\371\377\035\003\371\377B\303B\377\352Y\204\377\315#U\377\315#U\377"
+  "B\303B\377B\303B\377\315#U\377\352Y\204\377\352Y\204\377\352Y\204\377\352"
+  "Y\204\377\000\000\000\000\000\000\000\000\000\000\000\000\035\003\371\377\035\003\371\377\035\003\371\377"
+  "\035\003\371\377\035\003\371\377\000\000\000\000B\303B\377\315#U\377\315#U\377B\303B\377"
+  "B\303B\377B\303B\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377\315#U\377\315#U\377B\303B\377B\303"
+  "B\377B\303B\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000",
+};
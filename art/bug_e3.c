@@ -0,0 +1,40 @@
+/* GIMP RGBA C-Source image dump (bug_e3.c) */
+
+static const struct {
+  guint  	 width;
+  guint  	 height;
+  guint  	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
+  guint8 	 pixel_data[19 * 11 * 4 + 1];
+} bug_e3 = {
+  19, 11, 4,
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377\065\364"
+  "\065\377\000\000\000\000\065\364\065\377\000\000\000\000\025\020\022\377\025\020\022\377\025\020\022"
+  "\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\065\364"
+  "\065\377\000\000\000\000\000\000\000\000\315#U\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022"
+  "\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\035\003\371\377\035\003\371\377"
+  "\035\003\371\377\035\003\371\377\035\003\371\377\035\003\371\377\065\364\065\377\065\364"
+  "\065\377\000\000\000\000\000\000\000\000\000\000\000\000\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\000\000\000\000\000\000\000\000B\303B\377\035\003\371\377"
+  "\035\003\371\377\035\003\371\377\035\003\371\377\035\003\371\377\035\003\371\377\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\025\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\352Y\204\377\352Y\204\377\000\000\000\000\352"
+  "Y\204\377\343\377\000\377\343\377\000\377\343\377\000\377\025\020\022\377\025\020\022"
+  "\377\352Y\204\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\000\000\000\000\000\000\000\000\000\000\000\000\352Y\204\377\352Y\204\377\352Y\204\377\352"
+  "Y\204\377\343\377\000\377\343\377\000\377\343\377\000\377\343\377\000\377\343\377"
+  "\000\377\025\020\022\377\025\020\022\377\000\000\000\000\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\343\377\000\377\343\377\000\377\343\377\000\377\343\377\000\377\343\377"
+  "\000\377\343\377\000\377\025\020\022\377\025\020\022\377\000\000\000\000\025\020\022\377\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377\000\000\000\000\000\000\000\000"
+  "\025\020\022\377\025\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\315#U\377\000\000\000\000\000\000\000\000\025\020\022\377\025\020\022\377\025\020\022\377\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+};
@@ -0,0 +1,11 @@
+/* GIMP RGBA C-Source image dump (laser_img.c) */
+
+static const struct {
+  guint  	 width;
+  guint  	 height;
+  guint  	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
+  guint8 	 pixel_data[1 * 4 * 4 + 1];
+} laser_img = {
+  1, 4, 4,
+  "\065\364\065\377\065\364\065\377\065\364\065\377\065\364\065\377",
+};
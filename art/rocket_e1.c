@@ -0,0 +1,54 @@
+/* GIMP RGBA C-Source image dump (rocket_e1.c) */
+
+static const struct {
+  guint  	 width;
+  guint  	 height;
+  guint  	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
+  guint8 	 pixel_data[14 * 23 * 4 + 1];
+} rocket_e1 = {
+  14, 23, 4,
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\025\020\022\377"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\352Y\204\377\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\352"
+  "Y\204\377\315#U\377\315#U\377\352Y\204\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\352Y\204\377\315#U\377\315"
+  "#U\377\315#U\377\315#U\377\352Y\204\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377\315#U\377\315#U\377\315#U"
+  "\377\315#U\377\315#U\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\025\020\022\377\315#U\377\315#U\377\315#U\377\315#U\377\315#U\377\315#"
+  "U\377\315#U\377\352Y\204\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\025\020\022\377\315#U\377\315#U\377\315#U\377\025\020\022\377\025\020\022\377\315"
+  "#U\377\000\000\000\000\315#U\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025"
+  "\020\022\377\000\000\000\000\000\000\000\000\025\020\022\377B\303B\377\065\364\065\377\025\020\022"
+  "\377\315#U\377\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020"
+  "\022\377\315#U\377\000\000\000\000\025\020\022\377B\303B\377\000\000\000\000\025\020\022\377\315"
+  "#U\377\315#U\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377"
+  "\315#U\377\315#U\377\000\000\000\000B\303B\377B\303B\377\025\020\022\377\315#U\377\315"
+  "#U\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377\315#U\377"
+  "\315#U\377\025\020\022\377\025\020\022\377\315#U\377\315#U\377\315#U\377\025\020"
+  "\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\315#U\377\315#U\377"
+  "\315#U\377\315#U\377\315#U\377\315#U\377\315#U\377\315#U\377\025\020\022\377"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\225\035@\377\315#U\377\000\000\000"
+  "\000\315#U\377\315#U\377\315#U\377\000\000\000\000\315#U\377\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\025\020\022\377\225\035@\377\315#U\377\315#U\377\315#U\377"
+  "\315#U\377\315#U\377\315#U\377\225\035@\377\025\020\022\377\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\225\035@\377\315#U\377\315#U\377\000\000\000"
+  "\000\000\000\000\000\315#U\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\025\020\022\377\225\035@\377\225\035@\377\000\000\000\000\000\000\000\000\000\000\000\000\225"
+  "\035@\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\065"
+  "\364\065\377\000\000\000\000\225\035@\377\000\000\000\000\315#U\377\315#U\377\225\035@\377\065"
+  "\364\065\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\065\364\065\377"
+  "B\303B\377B\303B\377\225\035@\377\000\000\000\000\225\035@\377\225\035@\377B\303B\377"
+  "B\303B\377\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\025\020\022\377B\303B\377B\303"
+  "B\377B\303B\377\025\020\022\377\000\000\000\000\225\035@\377\025\020\022\377B\303B\377\000"
+  "\000\000\000B\303B\377\025\020\022\377\000\000\000\000\000\000\000\000B\303B\377B\303B\377B\303B\377"
+  "\022\212\022\377\025\020\022\377\025\020\022\377\025\020\022\377\025\020\022\377\022\212"
+  "\022\377B\303B\377B\303B\377\065\364\065\377\000\000\000\000\025\020\022\377B\303B\377"
+  "\022\212\022\377\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000B\303B\377B\303B\377\025\020\022\377\025\020\022\377\022\212\022\377\025"
+  "\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000",
+};
@@ -1,11 +1,11 @@
-/* GIMP RGBA C-Source image dump (rocket.c) */
+/* GIMP RGBA C-Source image dump (rocket_img.c) */
 
 static const struct {
   guint  	 width;
   guint  	 height;
   guint  	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
   guint8 	 pixel_data[14 * 23 * 4 + 1];
-} rocket = {
+} rocket_img = {
   14, 23, 4,
   "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\025\020\022\377"
   "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
@@ -54,4 +54,3 @@ static const struct {
   "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377"
   "\000\000\000\000",
 };
-
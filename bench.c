@@ -0,0 +1,152 @@
+/*
+ * Drawing benchmark. Renders the same stretch of game play with each gl
+ * engine and reports the time per frame over the uart. Build and run
+ * with `make bench`.
+ *
+ * The scene is what the game draws in a busy frame: the banking rocket,
+ * falling asteroids, walking bugs and lasers below the banner, then the
+ * banner itself. Objects move along fixed paths, so every engine draws
+ * exactly the same frames. Every engine is timed twice, before and
+ * after `mmu_init` turns on the caches.
+ *
+ * A second test animates a wall of bugs walking in place on a screen
+ * that is never cleared, once redrawing each bug's whole box every frame
+ * and once with `anim_update`, which writes only the pixels that changed.
+ */
+
+#include "uart.h"
+#include "mymodule.h"
+#include "gl.h"
+#include "hud.h"
+#include "timer.h"
+#include "printf.h"
+#include "assert.h"
+#include "mmu.h"
+#include "sprites.h"
+
+#define BENCH_FRAMES 200
+#define NUM_ASTEROIDS 8
+#define NUM_BUGS 2
+#define NUM_LASERS 3
+#define WALL_COLS 6
+#define WALL_ROWS 4
+
+// as in myprogram.c
+#define BANNER_HEIGHT 35
+#define BANNER_COLOR 0xffaa8eed
+#define BACKGROUND_COLOR 0xff121015
+
+static anim_player_t *bug_players[NUM_BUGS];
+
+/* draws frame f of the scene */
+static void draw_scene(int f)
+{
+	int width = gl_get_width(), height = gl_get_height();
+
+	gl_clear(BACKGROUND_COLOR);
+	gl_set_clip(0, BANNER_HEIGHT, width, height - BANNER_HEIGHT);
+
+	// the rocket sweeps left and right, banking through every frame
+	int sweep = f % (2 * ROCKET_BANK_COUNT);
+	int bank = (sweep < ROCKET_BANK_COUNT) ? sweep : 2 * ROCKET_BANK_COUNT - 1 - sweep;
+	const img_t *rocket = rocket_bank[bank];
+	gl_draw_img(200 + bank * 30 + (rocket_img.pivot_x - rocket->pivot_x) * SCALE,
+	            400 + (rocket_img.pivot_y - rocket->pivot_y) * SCALE, rocket, SCALE);
+
+	for (int i = 0; i < NUM_ASTEROIDS; i++) {
+		const img_t *img = (i % 3 == 0) ? &asteroid1_img : (i % 3 == 1) ? &asteroid2_img : &asteroid3_img;
+		gl_draw_img(40 + i * 70, (f * 12 + i * 97) % (height + 60) - 60, img, SCALE);
+	}
+
+	for (int i = 0; i < NUM_BUGS; i++) {
+		anim_next(bug_players[i]);
+		gl_draw_img(120 + i * 300, (f * 8 + i * 200) % (height + 30) - 30, anim_sprite(bug_players[i]), SCALE);
+	}
+
+	for (int i = 0; i < NUM_LASERS; i++)
+		gl_draw_img(260 + i * 40, height - (f * 20 + i * 150) % height, &laser_img, SCALE);
+
+	hud_set_points(f);
+	hud_set_high_score(BENCH_FRAMES);
+	hud_draw();
+	gl_swap_buffer();
+}
+
+/* times the scene drawn with the engine selected by mode */
+static void run(const char *name, gl_mode_t mode)
+{
+	gl_init(640, 480, mode);
+	hud_init(gl_get_width(), BANNER_HEIGHT, SCALE, BANNER_COLOR, BACKGROUND_COLOR, GL_WHITE);
+	for (int i = 0; i < NUM_BUGS; i++) {
+		bug_players[i] = anim_player_new(&bug_walk);
+		assert(bug_players[i]);
+	}
+
+	draw_scene(0); // both buffers are touched once before timing
+	draw_scene(1);
+	unsigned int start = timer_get_ticks();
+	for (int f = 0; f < BENCH_FRAMES; f++)
+		draw_scene(f);
+	unsigned int elapsed = timer_get_ticks() - start;
+	printf("%s: %d frames in %d us, %d us/frame\n", name, BENCH_FRAMES, elapsed, elapsed / BENCH_FRAMES);
+
+	for (int i = 0; i < NUM_BUGS; i++)
+		anim_player_free(bug_players[i]);
+}
+
+/* times the wall of bugs walking in place, redrawn whole or by anim_update */
+static void run_wall(const char *name, bool update)
+{
+	static anim_player_t *wall[WALL_ROWS * WALL_COLS];
+
+	gl_init(640, 480, GL_DOUBLEBUFFER);
+	for (int i = 0; i < 2; i++) {
+		gl_clear(BACKGROUND_COLOR);
+		gl_swap_buffer();
+	}
+	for (int i = 0; i < WALL_ROWS * WALL_COLS; i++) {
+		wall[i] = anim_player_new(&bug_walk);
+		assert(wall[i]);
+		for (int skip = 0; skip < i; skip++) // out of step with each other
+			anim_next(wall[i]);
+	}
+
+	unsigned int start = 0;
+	for (int f = -2; f < BENCH_FRAMES; f++) { // both buffers are drawn once before timing
+		if (f == 0)
+			start = timer_get_ticks();
+		for (int i = 0; i < WALL_ROWS * WALL_COLS; i++) {
+			int x = 20 + (i % WALL_COLS) * 100, y = 20 + (i / WALL_COLS) * 110;
+			anim_next(wall[i]);
+			if (update) {
+				anim_update(wall[i], x, y, SCALE, BACKGROUND_COLOR);
+			} else {
+				const img_t *img = anim_sprite(wall[i]);
+				gl_draw_rect(x, y, img->width * SCALE, img->height * SCALE, BACKGROUND_COLOR);
+				gl_draw_img(x, y, img, SCALE);
+			}
+		}
+		gl_swap_buffer();
+	}
+	unsigned int elapsed = timer_get_ticks() - start;
+	printf("%s: %d frames in %d us, %d us/frame\n", name, BENCH_FRAMES, elapsed, elapsed / BENCH_FRAMES);
+
+	for (int i = 0; i < WALL_ROWS * WALL_COLS; i++)
+		anim_player_free(wall[i]);
+}
+
+void main(void)
+{
+	uart_init();
+	for (int cached = 0; cached < 2; cached++) {
+		if (cached)
+			mmu_init();
+		printf("caches %s\n", cached ? "on" : "off");
+		run("immediate", GL_DOUBLEBUFFER);
+		run("immediate+dma", GL_DOUBLEBUFFER | GL_DMA);
+		run("composite", GL_DOUBLEBUFFER | GL_COMPOSITE);
+		run_wall("bug wall redrawn", false);
+		run_wall("bug wall updated", true);
+	}
+	uart_putchar(EOT);
+}
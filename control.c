@@ -0,0 +1,58 @@
+#include "control.h"
+#include <stdbool.h>
+
+// each reading moves the filtered tilt 1 / 2^SMOOTHING of the way to it
+#define SMOOTHING 1
+
+// tilts from level that start the rocket moving, and that stop it again
+#define DEADZONE_ENTER FIX_CONST(7)
+#define DEADZONE_EXIT  FIX_CONST(5)
+
+// the curve is sampled every 4 degrees past the deadzone
+#define STEP_SHIFT (FIX_SHIFT + 2)
+#define STEPS      16
+#define MAX_PAST   ((fix_t)STEPS << STEP_SHIFT)
+
+static fix_t curve[STEPS + 2]; // the last entry repeats, for interpolating at the end
+static fix_t filtered;
+static bool moving;
+
+void control_init(fix_t max_speed, fix_t full_tilt)
+{
+	// half linear, half square: slow to leave the deadzone, full speed at full tilt
+	fix_t span = full_tilt - DEADZONE_EXIT;
+	for (int i = 0; i <= STEPS; i++) {
+		fix_t u = fix_clamp(fix_div((fix_t)i << STEP_SHIFT, span), 0, FIX_ONE);
+		curve[i] = fix_mul(max_speed, (u + fix_mul(u, u)) / 2);
+	}
+	curve[STEPS + 1] = curve[STEPS];
+	control_reset();
+}
+
+void control_reset(void)
+{
+	filtered = 0;
+	moving = false;
+}
+
+fix_t control_update(fix_t tilt)
+{
+	filtered += (tilt - filtered) >> SMOOTHING;
+
+	int sign = (filtered > 0) - (filtered < 0);
+	fix_t magnitude = filtered * sign;
+	moving = magnitude >= (moving ? DEADZONE_EXIT : DEADZONE_ENTER);
+	if (!moving)
+		return 0;
+
+	fix_t past = magnitude - DEADZONE_EXIT;
+	past = (past < MAX_PAST) ? past : MAX_PAST;
+	int i = past >> STEP_SHIFT;
+	fix_t fraction = (past & ((1 << STEP_SHIFT) - 1)) >> (STEP_SHIFT - FIX_SHIFT);
+	return sign * fix_lerp(curve[i], curve[i + 1], fraction);
+}
+
+fix_t control_get_tilt(void)
+{
+	return filtered;
+}
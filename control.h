@@ -0,0 +1,60 @@
+#ifndef CONTROL_H
+#define CONTROL_H
+
+/*
+ * Analog tilt control: turns the roll of the controller into a speed.
+ *
+ * Each reading passes through three steps:
+ *  - a low-pass filter (an exponential moving average), so one noisy
+ *    sample moves the tilt only a little;
+ *  - a deadzone around level with hysteresis, so the rocket holds still
+ *    when the controller is held about level and does not flicker
+ *    between still and moving at the edge;
+ *  - a response curve, gentle near the deadzone for fine aiming and
+ *    steeper toward full tilt. The curve is worked out once into a
+ *    table, and each reading looks it up and interpolates.
+ *
+ * The speed changes continuously with the tilt instead of in steps.
+ * Because the filter carries over from reading to reading, one reading
+ * per frame is enough. The roll from `accel_roll` is already low in
+ * noise, so the filter is light and adds little lag.
+ */
+
+#include "fixed.h"
+
+/*
+ * `control_init`
+ *
+ * Build the response curve and reset the filter.
+ *
+ * @param max_speed  the speed at full tilt, in pixels per frame
+ * @param full_tilt  the tilt, in degrees either side of level, from
+ *                   which on the speed is max_speed
+ */
+void control_init(fix_t max_speed, fix_t full_tilt);
+
+/*
+ * `control_reset`
+ *
+ * Forget past readings, as for a new game.
+ */
+void control_reset(void);
+
+/*
+ * `control_update`
+ *
+ * Filter in a new reading and return the speed for it.
+ *
+ * @param tilt  the roll in degrees, negative to the left
+ * @return      the speed in pixels per frame, negative to the left
+ */
+fix_t control_update(fix_t tilt);
+
+/*
+ * `control_get_tilt`
+ *
+ * @return  the filtered tilt in degrees, negative to the left
+ */
+fix_t control_get_tilt(void);
+
+#endif
@@ -0,0 +1,262 @@
+#include "dma.h"
+#include "mmu.h"
+#include "assert.h"
+#include <stddef.h>
+
+// the controller is driven on the Pi itself; other builds move the bytes
+// with the CPU
+#if defined(__arm__) && !defined(__linux__)
+
+struct DMA { // registers of one DMA channel
+	unsigned int control_status;
+	unsigned int control_block;
+	unsigned int transfer_info;
+	unsigned int source;
+	unsigned int dest;
+	unsigned int transfer_length;
+	unsigned int stride;
+	unsigned int next_control_block;
+	unsigned int debug;
+};
+
+#define CS_ACTIVE                0x00000001
+#define CS_END                   0x00000002
+#define CS_ERROR                 0x00000100
+#define CS_PRIORITY              0x00080000 // middle priority, panic priority 0
+#define CS_RESET                 0x80000000
+
+#define TI_2D_MODE               0x00000002
+#define TI_WAIT_RESPONSE         0x00000008
+#define TI_DEST_INC              0x00000010
+#define TI_DEST_128              0x00000020
+#define TI_SRC_INC               0x00000100
+#define TI_SRC_128               0x00000200
+#define TI_BURST_2               0x00002000
+
+// limits of a single 2D block
+#define MAX_ROW_BYTES 0xffff
+#define MAX_ROWS      0x4000
+#define MAX_STRIDE    0x7fff
+
+/*
+ * Channels 0-6 of the 16 are full channels that can do 2D blocks. The
+ * firmware leaves channel 5 alone. The controller sees memory through
+ * the bus addresses at 0x40000000, the same L2-cached alias the ARM uses.
+ */
+#define DMA_BASE 0x20007000
+#define DMA_CHANNEL 5
+#define BUS_ADDRESS(p) (((unsigned int)(p) & 0x3fffffff) | 0x40000000)
+
+static volatile struct DMA *dma = (struct DMA *)(DMA_BASE + DMA_CHANNEL * 0x100);
+static volatile unsigned int *dma_enable = (unsigned int *)(DMA_BASE + 0xff0);
+
+// a control block as the controller reads it, followed by the value a
+// fill reads 16 bytes at a time and the fence of the block
+typedef struct {
+	unsigned int transfer_info;
+	unsigned int source;
+	unsigned int dest;
+	unsigned int transfer_length;
+	unsigned int stride;
+	unsigned int next_control_block;
+	unsigned int reserved[2];
+	unsigned int value[4];
+	dma_fence_t fence;
+	unsigned int unused[3];
+} __attribute__((aligned(32))) block_t;
+
+// the blocks are used round robin; a block is only refilled once the
+// controller is past it
+#define NUM_BLOCKS 32
+static volatile block_t blocks[NUM_BLOCKS];
+static unsigned int next_block;
+static volatile block_t *last_block; // the end of the chain, NULL if none yet
+static dma_fence_t issued;           // the fence of last_block
+static dma_fence_t retired;          // a fence the controller is known to be past
+
+/* the fence of the last block the controller has finished */
+static dma_fence_t finished(void)
+{
+	// 0 when the chain ran out. any other block than ours, such as one
+	// the firmware left before dma_init, is not working on our chain
+	unsigned int offset = dma->control_block - BUS_ADDRESS(blocks);
+	if (offset >= sizeof(blocks))
+		return issued;
+	return blocks[offset / sizeof(block_t)].fence - 1;
+}
+
+bool dma_done(dma_fence_t fence)
+{
+	// fences already seen passed cost no read of the controller
+	if ((int)(retired - fence) >= 0)
+		return true;
+	retired = finished();
+	return (int)(retired - fence) >= 0;
+}
+
+void dma_wait(dma_fence_t fence)
+{
+	while (!dma_done(fence))
+		assert(!(dma->control_status & CS_ERROR));
+}
+
+void dma_init(void)
+{
+	dma_wait(issued);
+	*dma_enable |= 1 << DMA_CHANNEL;
+	dma->control_status = CS_RESET;
+	while (dma->control_status & CS_RESET)
+		;
+	dma->control_block = 0;
+	for (int i = 0; i < NUM_BLOCKS; i++)
+		blocks[i].fence = 0;
+	next_block = 0;
+	last_block = NULL;
+	issued = retired = 0;
+}
+
+/* fills in the next free block and links it to the end of the chain. a
+   block without TI_SRC_INC reads value from the block itself */
+static void queue(unsigned int info, unsigned int src, unsigned int dst,
+                  unsigned int length, unsigned int stride, unsigned int value)
+{
+	volatile block_t *b = &blocks[next_block];
+	dma_wait(b->fence);
+	next_block = (next_block + 1) % NUM_BLOCKS;
+
+	if (!(info & TI_SRC_INC)) {
+		for (int i = 0; i < 4; i++)
+			b->value[i] = value;
+		src = BUS_ADDRESS(b->value);
+	}
+	b->transfer_info = info;
+	b->source = src;
+	b->dest = dst;
+	b->transfer_length = length;
+	b->stride = stride;
+	b->next_control_block = 0;
+	b->fence = issued + 1;
+	mmu_clean_range((const void *)b, sizeof(block_t));
+	if (last_block) {
+		last_block->next_control_block = BUS_ADDRESS(b);
+		mmu_clean_range((const void *)last_block, sizeof(block_t));
+	}
+
+	// pause the channel so it cannot move on while the block is linked in.
+	// a channel still on the old last block has already loaded its next
+	// address, so that register is patched; one on an earlier block will
+	// find the link in memory
+	dma->control_status = 0;
+	unsigned int address = dma->control_block;
+	if (address == 0)
+		dma->control_block = BUS_ADDRESS(b);
+	else if (address == BUS_ADDRESS(last_block))
+		dma->next_control_block = BUS_ADDRESS(b);
+	dma->control_status = CS_ACTIVE | CS_PRIORITY;
+
+	last_block = b;
+	issued++;
+}
+
+/* queues a block of height rows of width bytes, split into as many
+   blocks as the limits of the controller need. without TI_SRC_INC it is
+   filled with value instead of copied from src */
+static dma_fence_t transfer(unsigned int info, unsigned int src, unsigned int src_pitch,
+                            unsigned int dst, unsigned int dst_pitch, unsigned int width, unsigned int height,
+                            unsigned int value)
+{
+	if (width == 0 || height == 0)
+		return 0;
+	assert(src_pitch >= width && dst_pitch >= width);
+
+	// 128-bit reads and writes when everything is aligned to them
+	unsigned int src_step = (info & TI_SRC_INC) ? src_pitch : 0;
+	if (((src_step ? src | src_pitch : 0) & 15) == 0 && ((dst | dst_pitch | width) & 15) == 0)
+		info |= TI_SRC_128 | TI_DEST_128 | TI_BURST_2;
+
+	// rows that follow each other in both are one long run
+	if (src_pitch == width && dst_pitch == width && height < (1 << 30) / width) {
+		queue(info, src, dst, width * height, 0, value);
+		return issued;
+	}
+
+	if (width <= MAX_ROW_BYTES && src_pitch - width <= MAX_STRIDE && dst_pitch - width <= MAX_STRIDE) {
+		unsigned int stride = ((dst_pitch - width) << 16) | (src_step ? src_pitch - width : 0);
+		while (height > 0) {
+			unsigned int rows = (height < MAX_ROWS) ? height : MAX_ROWS;
+			queue(info | TI_2D_MODE, src, dst, ((rows - 1) << 16) | width, stride, value);
+			src += rows * src_step;
+			dst += rows * dst_pitch;
+			height -= rows;
+		}
+	} else {
+		for (; height > 0; height--, src += src_step, dst += dst_pitch)
+			queue(info, src, dst, width, 0, value);
+	}
+	return issued;
+}
+
+/* the bytes from the first of a block to its last */
+static unsigned int extent(unsigned int pitch, unsigned int width, unsigned int height)
+{
+	return height ? (height - 1) * pitch + width : 0;
+}
+
+dma_fence_t dma_fill(void *dst, unsigned int dst_pitch, unsigned int width, unsigned int height,
+                     unsigned int value)
+{
+	// cached lines of the destination would hide the transfer or be
+	// written back over it
+	mmu_flush_range(dst, extent(dst_pitch, width, height));
+	return transfer(TI_DEST_INC | TI_WAIT_RESPONSE, 0, width, BUS_ADDRESS(dst), dst_pitch,
+	                width, height, value);
+}
+
+dma_fence_t dma_copy(void *dst, unsigned int dst_pitch, const void *src, unsigned int src_pitch,
+                     unsigned int width, unsigned int height)
+{
+	mmu_clean_range(src, extent(src_pitch, width, height));
+	mmu_flush_range(dst, extent(dst_pitch, width, height));
+	return transfer(TI_SRC_INC | TI_DEST_INC | TI_WAIT_RESPONSE, BUS_ADDRESS(src), src_pitch,
+	                BUS_ADDRESS(dst), dst_pitch, width, height, 0);
+}
+
+#else
+
+void dma_init(void)
+{
+}
+
+dma_fence_t dma_fill(void *dst, unsigned int dst_pitch, unsigned int width, unsigned int height,
+                     unsigned int value)
+{
+	for (unsigned int y = 0; y < height; y++) {
+		unsigned int *row = (unsigned int *)((char *)dst + y * dst_pitch);
+		for (unsigned int x = 0; x < width / 4; x++)
+			row[x] = value;
+	}
+	return 0;
+}
+
+dma_fence_t dma_copy(void *dst, unsigned int dst_pitch, const void *src, unsigned int src_pitch,
+                     unsigned int width, unsigned int height)
+{
+	for (unsigned int y = 0; y < height; y++) {
+		unsigned char *to = (unsigned char *)dst + y * dst_pitch;
+		const unsigned char *from = (const unsigned char *)src + y * src_pitch;
+		for (unsigned int x = 0; x < width; x++)
+			to[x] = from[x];
+	}
+	return 0;
+}
+
+bool dma_done(dma_fence_t fence)
+{
+	return true;
+}
+
+void dma_wait(dma_fence_t fence)
+{
+}
+
+#endif
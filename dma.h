@@ -0,0 +1,82 @@
+#ifndef DMA_H
+#define DMA_H
+
+/*
+ * Memory to memory transfers on the DMA controller of the BCM2835.
+ *
+ * A transfer moves a block of height rows of width bytes, where each
+ * row starts pitch bytes after the one before, so a rectangle of a
+ * surface or the framebuffer is a single transfer. Transfers are queued
+ * as a chain of control blocks that the controller works through by
+ * itself, in the order they were queued, while the CPU carries on. Each
+ * call returns a fence that tells when its transfer is complete.
+ *
+ * Built for anything but the Pi itself, the transfers are done by the
+ * CPU before the call returns and every fence is already passed. The
+ * controller is also modeled by QEMU's raspi machines, so the Pi build
+ * can be tried there with `make qemu-bench`.
+ */
+
+#include <stdbool.h>
+
+/*
+ * `dma_fence_t`
+ *
+ * Marks a point in the queue of transfers. Fence 0 is always passed.
+ */
+typedef unsigned int dma_fence_t;
+
+/*
+ * `dma_init`
+ *
+ * Reset the DMA channel and empty the queue, after waiting for any
+ * transfer still running. Fences from before are passed afterwards.
+ */
+void dma_init(void);
+
+/*
+ * `dma_fill`
+ *
+ * Queue filling a block with copies of a 32-bit value.
+ *
+ * @param dst        the first byte of the block
+ * @param dst_pitch  the bytes from the start of one row to the next
+ * @param width      the bytes in a row, a multiple of 4
+ * @param height     the number of rows
+ * @param value      the word written over the block
+ * @return           the fence passed when the block is filled
+ */
+dma_fence_t dma_fill(void *dst, unsigned int dst_pitch, unsigned int width, unsigned int height,
+                     unsigned int value);
+
+/*
+ * `dma_copy`
+ *
+ * Queue copying a block from src to dst. The two must not overlap.
+ *
+ * @param dst        the first byte of the destination block
+ * @param dst_pitch  the bytes from the start of one row of dst to the next
+ * @param src        the first byte of the source block
+ * @param src_pitch  the bytes from the start of one row of src to the next
+ * @param width      the bytes in a row
+ * @param height     the number of rows
+ * @return           the fence passed when the block is copied
+ */
+dma_fence_t dma_copy(void *dst, unsigned int dst_pitch, const void *src, unsigned int src_pitch,
+                     unsigned int width, unsigned int height);
+
+/*
+ * `dma_done`
+ *
+ * @return  true if every transfer up to fence is complete
+ */
+bool dma_done(dma_fence_t fence);
+
+/*
+ * `dma_wait`
+ *
+ * Wait until every transfer up to fence is complete.
+ */
+void dma_wait(dma_fence_t fence);
+
+#endif
@@ -1,6 +1,7 @@
 #include "fb.h"
 #include "assert.h"
 #include "mailbox.h"
+#include "mmu.h"
 
 typedef struct {
     unsigned int width;       // width of the physical screen
@@ -13,10 +14,20 @@ typedef struct {
     unsigned int y_offset;    // y of the upper left corner of the virtual fb
     void *framebuffer;        // pointer to the start of the framebuffer
     unsigned int total_bytes; // total number of bytes in the framebuffer
-} fb_config_t;
+} __attribute__ ((aligned(32))) fb_config_t; // whole cache lines, shared with nothing else
 
 // fb is volatile because the GPU will write to it
-static volatile fb_config_t fb __attribute__ ((aligned(16)));
+static volatile fb_config_t fb;
+
+/* sends fb to the GPU. with the data cache on, fb is written back to RAM
+   for the GPU to read and dropped from the cache so its reply is seen */
+static bool fb_request(void)
+{
+    mmu_flush_range((void *)&fb, sizeof(fb));
+    bool success = mailbox_request(MAILBOX_FRAMEBUFFER, (unsigned int)&fb);
+    mmu_invalidate_range((void *)&fb, sizeof(fb));
+    return success;
+}
 
 void fb_init(unsigned int width, unsigned int height, unsigned int depth_in_bytes, fb_mode_t mode)
 {
@@ -37,8 +48,9 @@ void fb_init(unsigned int width, unsigned int height, unsigned int depth_in_byte
     fb.total_bytes = 0;
 
     // Send address of fb struct to the GPU as message
-    bool mailbox_success = mailbox_request(MAILBOX_FRAMEBUFFER, (unsigned int)&fb);
+    bool mailbox_success = fb_request();
     assert(mailbox_success); // confirm successful config
+    mmu_set_framebuffer(fb.framebuffer, fb.total_bytes);
 }
 
 
@@ -51,7 +63,7 @@ void fb_swap_buffer(void)
 	else
 		fb.y_offset = 0;
 	// Send address of fb struct to the GPU as message
-    bool mailbox_success = mailbox_request(MAILBOX_FRAMEBUFFER, (unsigned int)&fb);
+    bool mailbox_success = fb_request();
     assert(mailbox_success); // confirm successful config
 }
 
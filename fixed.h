@@ -0,0 +1,167 @@
+#ifndef FIXED_H
+#define FIXED_H
+
+/*
+ * Q16.16 fixed-point numbers, for positions and velocities finer than a
+ * pixel without floating point.
+ *
+ * A `fix_t` holds its value times 65536: the high 16 bits are the whole
+ * part and the low 16 bits the fraction, so values from -32768 to just
+ * under 32768 are kept to 1/65536. Adding, subtracting and comparing
+ * are done with the ordinary integer operators; the functions below
+ * cover the rest. Each is a few instructions and is inlined.
+ *
+ * Dividing needs the division routine of libgcc, which the ARM1176 has
+ * no instruction for. Where the same divisor is used again and again,
+ * take its `fix_reciprocal` once and multiply by that instead.
+ */
+
+typedef int fix_t;
+
+#define FIX_SHIFT 16
+#define FIX_ONE   (1 << FIX_SHIFT)
+#define FIX_HALF  (FIX_ONE / 2)
+#define FIX_MAX   0x7fffffff
+#define FIX_MIN   (-FIX_MAX - 1)
+
+/* a constant such as FIX_CONST(0.25), worked out by the compiler; use it
+   only with constants, or it brings in floating point */
+#define FIX_CONST(x) ((fix_t)((x) * FIX_ONE + ((x) < 0 ? -0.5 : 0.5)))
+
+/*
+ * `fix_from_int`
+ *
+ * @param i  a whole number from -32768 to 32767
+ * @return   i as a fixed-point number
+ */
+static inline fix_t fix_from_int(int i)
+{
+	return (fix_t)((unsigned int)i << FIX_SHIFT);
+}
+
+/*
+ * `fix_floor`
+ *
+ * @return  the largest whole number not above f
+ */
+static inline int fix_floor(fix_t f)
+{
+	return f >> FIX_SHIFT;
+}
+
+/*
+ * `fix_round`
+ *
+ * @return  the whole number nearest to f, halves rounded up. This is how
+ *          a position becomes a pixel.
+ */
+static inline int fix_round(fix_t f)
+{
+	return (int)(((long long)f + FIX_HALF) >> FIX_SHIFT);
+}
+
+/* the product or quotient of a wider computation, brought back into range */
+static inline fix_t fix_saturate(long long x)
+{
+	if (x > FIX_MAX)
+		return FIX_MAX;
+	if (x < FIX_MIN)
+		return FIX_MIN;
+	return (fix_t)x;
+}
+
+/*
+ * `fix_mul`
+ *
+ * @return  a times b, rounded toward minus infinity. The result must fit.
+ */
+static inline fix_t fix_mul(fix_t a, fix_t b)
+{
+	return (fix_t)((long long)a * b >> FIX_SHIFT);
+}
+
+/*
+ * `fix_mul_sat`
+ *
+ * @return  a times b, or the nearest limit if that does not fit
+ */
+static inline fix_t fix_mul_sat(fix_t a, fix_t b)
+{
+	return fix_saturate((long long)a * b >> FIX_SHIFT);
+}
+
+/*
+ * `fix_add_sat`
+ *
+ * @return  a plus b, or the nearest limit if that does not fit
+ */
+static inline fix_t fix_add_sat(fix_t a, fix_t b)
+{
+	return fix_saturate((long long)a + b);
+}
+
+/*
+ * `fix_sub_sat`
+ *
+ * @return  a minus b, or the nearest limit if that does not fit
+ */
+static inline fix_t fix_sub_sat(fix_t a, fix_t b)
+{
+	return fix_saturate((long long)a - b);
+}
+
+/*
+ * `fix_div`
+ *
+ * Divide with libgcc's 64-bit division; see `fix_reciprocal` for
+ * divisors that are used more than once.
+ *
+ * @return  a divided by b, rounded toward zero, or the nearest limit if
+ *          that does not fit. b must not be 0.
+ */
+static inline fix_t fix_div(fix_t a, fix_t b)
+{
+	return fix_saturate(((long long)a << FIX_SHIFT) / b);
+}
+
+/*
+ * `fix_reciprocal`
+ *
+ * @param d  a divisor, not 0
+ * @return   1 / d, so that fix_mul(a, fix_reciprocal(d)) is a / d to
+ *           within the precision of the reciprocal. Divisors under
+ *           1/32768 in size saturate.
+ */
+static inline fix_t fix_reciprocal(fix_t d)
+{
+	return fix_saturate((1LL << (2 * FIX_SHIFT)) / d);
+}
+
+/*
+ * `fix_clamp`
+ *
+ * @return  x, or lo if it is below lo, or hi if it is above hi
+ */
+static inline fix_t fix_clamp(fix_t x, fix_t lo, fix_t hi)
+{
+	if (x < lo)
+		return lo;
+	if (x > hi)
+		return hi;
+	return x;
+}
+
+/*
+ * `fix_lerp`
+ *
+ * @param a  the value at t = 0
+ * @param b  the value at t = 1
+ * @param t  how far to go from a to b, usually 0 to FIX_ONE
+ * @return   the value t of the way from a to b
+ */
+static inline fix_t fix_lerp(fix_t a, fix_t b, fix_t t)
+{
+	return a + (fix_t)((long long)(b - a) * t >> FIX_SHIFT);
+}
+
+#endif
@@ -1,16 +1,159 @@
 #include "gl.h"
+#include "dma.h"
 #include "font.h"
 #include "uart.h"
 #include "printf.h"
+#include "malloc.h"
+#include "assert.h"
+
+// the framebuffer draw buffer described as a surface; repointed on every swap
+static gl_surface_t fb_surface;
+
+// where all drawing goes, either &fb_surface or an off-screen surface
+static gl_surface_t *target = &fb_surface;
+
+// the part of the target sprites are drawn into, x0,y0 inclusive to x1,y1
+// exclusive. reset to the whole target whenever the target changes
+static struct {
+	int x0, y0, x1, y1;
+} clip;
+
+// every glyph of the font packed one bit per pixel, one word per row, bit 0
+// being the leftmost pixel. built once by gl_init
+#define GLYPH_COUNT 128
+static unsigned int *glyph_atlas;
+static int glyph_width, glyph_height;
+
+// the span compositor, used for the framebuffer with GL_COMPOSITE. drawing
+// is recorded as a list of items, composited one row at a time
+#define MAX_ITEMS 256
+
+typedef enum { ITEM_RECT, ITEM_SPRITE, ITEM_SURFACE, ITEM_KEYED, ITEM_GLYPH } item_kind_t;
+
+typedef struct {
+	item_kind_t kind;
+	int x0, y0, x1, y1;          // the part of the framebuffer it may cover
+	union {
+		color_t color;           // ITEM_RECT
+		struct item_sprite {     // ITEM_SPRITE
+			const gl_sprite_t *img;
+			const color_t *palette;
+			int box_x, scale;    // column 0 of the trimmed box and its width
+			int col0, col1;      // visible columns of the box
+			int next_y;          // the row at which row and sub are next used
+			int row, sub;        // sprite row and the target row within it
+		} sprite;
+		struct {                 // ITEM_SURFACE and ITEM_KEYED
+			const color_t *pixels; // the source pixel for x0,y0
+			unsigned int pitch;
+			color_t key;         // ITEM_KEYED: source pixels of this color are left out
+		} surface;
+		struct {                 // ITEM_GLYPH
+			const unsigned int *rows; // the glyph row drawn at y0, in the atlas
+			int shift;           // glyph columns clipped off the left
+			unsigned int mask;   // the columns left after clipping
+			color_t color;
+		} glyph;
+	} u;
+} item_t;
+
+static bool compositing;         // GL_COMPOSITE was given to gl_init
+static item_t *items;            // in drawing order, the last one in front
+static int item_count;
+static bool cleared;             // the frame starts from a gl_clear to clear_color
+static color_t clear_color;
+static color_t *line;            // the row being composited, or a sprite row being scaled
+static unsigned int *covered;    // bit x set once pixel x of line is final
+
+static void composite(void);
+
+// with GL_DMA, fills and copies into the framebuffer of at least this many
+// pixels are queued on the DMA controller; smaller ones cost less to draw
+#define DMA_MIN_PIXELS 2048
+static bool use_dma;
+static dma_fence_t fb_fence;     // the last transfer into the framebuffer
+static dma_fence_t copy_fence;   // the last transfer out of a surface
+
+struct gl_text {
+	gl_surface_t *surface;
+	color_t color;
+	unsigned int max_chars;
+	unsigned int width; // of the rendered string; only this much is copied
+	char str[];
+};
+
+static void fb_surface_update(void)
+{
+	fb_surface.width = fb_get_width();
+	fb_surface.height = fb_get_height();
+	fb_surface.pitch = fb_get_pitch() / 4;
+	fb_surface.pixels = fb_get_draw_buffer();
+}
+
+/* decodes each glyph once with font_get_glyph and packs its rows into bits,
+   so drawing text never has to decode or test one byte per pixel again */
+static void build_glyph_atlas(void)
+{
+	glyph_width = font_get_glyph_width();
+	glyph_height = font_get_glyph_height();
+	assert(glyph_width <= 32); // a glyph row must fit in one word
+
+	free(glyph_atlas);
+	glyph_atlas = malloc(GLYPH_COUNT * glyph_height * sizeof(unsigned int));
+	assert(glyph_atlas);
+
+	unsigned char buf[font_get_glyph_size()];
+	for (int ch = 0; ch < GLYPH_COUNT; ch++) {
+		unsigned int *rows = glyph_atlas + ch * glyph_height;
+		bool found = font_get_glyph(ch, buf, sizeof(buf));
+		for (int y = 0; y < glyph_height; y++) {
+			unsigned int bits = 0;
+			for (int x = 0; found && x < glyph_width; x++)
+				if (buf[y * glyph_width + x])
+					bits |= 1 << x;
+			rows[y] = bits; // missing glyphs are left blank
+		}
+	}
+}
+
+/* sets up the buffers of the span compositor for the current framebuffer */
+static void init_compositor(void)
+{
+	free(items);
+	free(covered);
+	items = malloc(MAX_ITEMS * sizeof(item_t));
+	covered = malloc((fb_surface.width + 31) / 32 * sizeof(unsigned int));
+	assert(items && covered);
+	item_count = 0;
+	cleared = false;
+}
 
 void gl_init(unsigned int width, unsigned int height, gl_mode_t mode)
 {
-    fb_init(width, height, 4, mode);    // use 32-bit depth always for graphics library
+	dma_wait(fb_fence);
+    fb_init(width, height, 4, mode & ~(GL_COMPOSITE | GL_DMA));    // use 32-bit depth always for graphics library
+	fb_surface_update();
+	gl_set_target(NULL);
+	build_glyph_atlas();
+	free(line);
+	line = malloc(fb_surface.width * sizeof(color_t));
+	assert(line);
+	compositing = (mode & GL_COMPOSITE) != 0;
+	if (compositing)
+		init_compositor();
+	use_dma = (mode & GL_DMA) != 0;
+	if (use_dma)
+		dma_init();
+	fb_fence = copy_fence = 0;
 }
 
 void gl_swap_buffer(void)
 {
+	if (compositing)
+		composite();
+	dma_wait(fb_fence);
     fb_swap_buffer();
+	fb_surface.pixels = fb_get_draw_buffer();
 }
 
 unsigned int gl_get_width(void)
@@ -32,151 +175,1059 @@ color_t gl_color(unsigned char r, unsigned char g, unsigned char b)
     return color;
 }
 
+/* x * a / 255 for 8-bit x and a, rounded, without a divide */
+static unsigned int mul_div_255(unsigned int x, unsigned int a)
+{
+	unsigned int t = x * a + 128;
+	return (t + (t >> 8)) >> 8;
+}
+
+color_t gl_color_alpha(unsigned char r, unsigned char g, unsigned char b, unsigned char a)
+{
+	return (a << 24) | (mul_div_255(r, a) << 16) | (mul_div_255(g, a) << 8) | mul_div_255(b, a);
+}
+
+gl_surface_t *gl_surface_new(unsigned int width, unsigned int height)
+{
+	gl_surface_t *s = malloc(sizeof(gl_surface_t));
+	if (!s)
+		return NULL;
+	// round pitch up to an even number of pixels so rows stay 8-byte aligned
+	s->width = width;
+	s->height = height;
+	s->pitch = (width + 1) & ~1;
+	s->pixels = malloc(s->pitch * height * sizeof(color_t));
+	if (!s->pixels) {
+		free(s);
+		return NULL;
+	}
+	return s;
+}
+
+/* composites the frame so far if a recorded item reads from surface s,
+   which is about to be drawn into or freed */
+static void release_surface(const gl_surface_t *s)
+{
+	const color_t *start = s->pixels, *end = s->pixels + s->pitch * s->height;
+	for (int i = 0; i < item_count; i++) {
+		const item_t *it = &items[i];
+		if ((it->kind == ITEM_SURFACE || it->kind == ITEM_KEYED)
+			&& it->u.surface.pixels >= start && it->u.surface.pixels < end) {
+			composite();
+			return;
+		}
+	}
+}
+
+void gl_surface_free(gl_surface_t *s)
+{
+	if (!s)
+		return;
+	if (target == s)
+		target = &fb_surface;
+	release_surface(s);
+	dma_wait(copy_fence);
+	free(s->pixels);
+	free(s);
+}
+
+void gl_set_target(gl_surface_t *s)
+{
+	// a surface may still be read by a DMA copy or by the compositor
+	if (s) {
+		release_surface(s);
+		dma_wait(copy_fence);
+	}
+	target = s ? s : &fb_surface;
+	gl_set_clip(0, 0, target->width, target->height);
+}
+
+gl_surface_t *gl_get_target(void)
+{
+	return target;
+}
+
+/* fills n pixels starting at dst with color c. this is the block fill used by
+   every solid primitive: it aligns to a doubleword and then stores 8 pixels
+   per iteration */
+static void fill_span(color_t *dst, int n, color_t c)
+{
+	if (n > 0 && ((unsigned int)dst & 4)) {
+		*dst++ = c;
+		n--;
+	}
+	unsigned long long cc = ((unsigned long long)c << 32) | c;
+	unsigned long long *d = (unsigned long long *)dst;
+	for (; n >= 8; n -= 8) {
+		d[0] = cc;
+		d[1] = cc;
+		d[2] = cc;
+		d[3] = cc;
+		d += 4;
+	}
+	dst = (color_t *)d;
+	while (n-- > 0)
+		*dst++ = c;
+}
+
+/* copies n pixels from src to dst, 4 at a time */
+static void copy_span(color_t *dst, const color_t *src, int n)
+{
+	for (; n >= 4; n -= 4) {
+		dst[0] = src[0];
+		dst[1] = src[1];
+		dst[2] = src[2];
+		dst[3] = src[3];
+		dst += 4;
+		src += 4;
+	}
+	while (n-- > 0)
+		*dst++ = *src++;
+}
+
+/* clips the w x h rectangle at x,y against the target. returns false if
+   nothing is left to draw */
+static bool clip_rect(int *x, int *y, int *w, int *h)
+{
+	if (*x < 0) {
+		*w += *x;
+		*x = 0;
+	}
+	if (*y < 0) {
+		*h += *y;
+		*y = 0;
+	}
+	if (*x + *w > (int)target->width)
+		*w = target->width - *x;
+	if (*y + *h > (int)target->height)
+		*h = target->height - *y;
+	return *w > 0 && *h > 0;
+}
+
+/* palette index of pixel x in a row of 4-bit sprite indices */
+static inline unsigned int sprite_index(const unsigned char *row, int x)
+{
+	return (row[x >> 1] >> ((x & 1) << 2)) & 0xf;
+}
+
+/* true while drawing goes to the span compositor instead of the target */
+static inline bool recording(void)
+{
+	return compositing && target == &fb_surface;
+}
+
+/* gets the framebuffer ready for the CPU to draw into: what was recorded
+   is composited and queued DMA transfers into it are waited for */
+static inline void flush(void)
+{
+	if (target != &fb_surface)
+		return;
+	if (compositing)
+		composite();
+	// 0 once waited for, so drawing without DMA never reads the controller
+	if (fb_fence) {
+		dma_wait(fb_fence);
+		fb_fence = 0;
+	}
+}
+
+/* true if a fill or copy of n pixels into the target goes to DMA */
+static inline bool offload(int n)
+{
+	return use_dma && target == &fb_surface && n >= DMA_MIN_PIXELS;
+}
+
+/* appends an item that covers at most x0,y0 up to x1,y1 to the frame. a
+   full list is composited first, which keeps the result the same */
+static item_t *record(item_kind_t kind, int x0, int y0, int x1, int y1)
+{
+	if (item_count == MAX_ITEMS)
+		composite();
+	item_t *it = &items[item_count++];
+	it->kind = kind;
+	it->x0 = x0;
+	it->y0 = y0;
+	it->x1 = x1;
+	it->y1 = y1;
+	return it;
+}
+
+/* writes pixels x0 up to x1 of the line that no item in front has covered,
+   copied from src or, when src is NULL, of color c. the range is taken a
+   mask word at a time, so a part that is all free or all covered costs a
+   single test. returns the number of pixels written */
+static int cover_span(int x0, int x1, const color_t *src, color_t c)
+{
+	int n = 0;
+	while (x0 < x1) {
+		int end = (x0 | 31) + 1;
+		if (end > x1)
+			end = x1;
+		unsigned int *word = &covered[x0 >> 5];
+		unsigned int bits = (end - x0 == 32) ? ~0U : ((1U << (end - x0)) - 1) << (x0 & 31);
+		unsigned int open = bits & ~*word;
+		if (open == bits) {
+			if (src)
+				copy_span(line + x0, src, end - x0);
+			else
+				fill_span(line + x0, end - x0, c);
+			n += end - x0;
+		} else if (open) {
+			for (int x = x0; x < end; x++) {
+				if (open & (1U << (x & 31))) {
+					line[x] = src ? src[x - x0] : c;
+					n++;
+				}
+			}
+		}
+		*word |= bits;
+		if (src)
+			src += end - x0;
+		x0 = end;
+	}
+	return n;
+}
+
+/* writes the free pixels of sprite item it on target row y, one call per
+   run of pixels of the same color. the sprite row is tracked by counting
+   target rows, rows that were skipped because the line was already full
+   included, so no divide is needed */
+static int cover_sprite(item_t *it, int y)
+{
+	struct item_sprite *sp = &it->u.sprite;
+	for (; sp->next_y < y; sp->next_y++) {
+		if (++sp->sub == sp->scale) {
+			sp->sub = 0;
+			sp->row++;
+		}
+	}
+
+	const gl_sprite_t *img = sp->img;
+	const unsigned char *indices = img->indices + sp->row * img->stride;
+	int n = 0;
+	for (int i = img->rows[sp->row]; i < img->rows[sp->row + 1]; i++) {
+		gl_span_t span = img->spans[i];
+		int x = (span.x < sp->col0) ? sp->col0 : span.x;
+		int to = (span.x + span.len > sp->col1) ? sp->col1 : span.x + span.len;
+		while (x < to) {
+			unsigned int index = sprite_index(indices, x);
+			int end = x + 1;
+			while (end < to && sprite_index(indices, end) == index)
+				end++;
+			int lo = sp->box_x + x * sp->scale, hi = sp->box_x + end * sp->scale;
+			if (lo < it->x0)
+				lo = it->x0;
+			if (hi > it->x1)
+				hi = it->x1;
+			if (lo < hi)
+				n += cover_span(lo, hi, NULL, sp->palette[index]);
+			x = end;
+		}
+	}
+	return n;
+}
+
+/* writes the pixels of row src from x0 up to x1 that are not the key color
+   and that no item in front has covered */
+static int cover_keyed(int x0, int x1, const color_t *src, color_t key)
+{
+	int n = 0;
+	for (int x = x0; x < x1; x++, src++) {
+		unsigned int bit = 1U << (x & 31);
+		if (*src != key && !(covered[x >> 5] & bit)) {
+			covered[x >> 5] |= bit;
+			line[x] = *src;
+			n++;
+		}
+	}
+	return n;
+}
+
+/* writes color c at x0 + i for each bit i set in bits, where no item in
+   front has covered the pixel */
+static int cover_bits(int x0, unsigned int bits, color_t c)
+{
+	int n = 0;
+	for (; bits; bits &= bits - 1) {
+		int x = x0 + __builtin_ctz(bits);
+		unsigned int bit = 1U << (x & 31);
+		if (!(covered[x >> 5] & bit)) {
+			covered[x >> 5] |= bit;
+			line[x] = c;
+			n++;
+		}
+	}
+	return n;
+}
+
+/* the first column from x on, before width, whose coverage is not on */
+static int run_end(int x, int width, bool on)
+{
+	while (x < width) {
+		unsigned int stop = (on ? ~covered[x >> 5] : covered[x >> 5]) >> (x & 31);
+		if (stop) {
+			x += __builtin_ctz(stop);
+			break;
+		}
+		x = (x | 31) + 1;
+	}
+	return (x < width) ? x : width;
+}
+
+/* writes framebuffer row dst in address order: the covered runs from the
+   line and the rest in the clear color, or left alone without a clear */
+static void write_row(color_t *dst, int width)
+{
+	for (int x = 0; x < width; ) {
+		bool on = covered[x >> 5] & (1U << (x & 31));
+		int end = run_end(x, width, on);
+		if (on)
+			copy_span(dst + x, line + x, end - x);
+		else if (cleared)
+			fill_span(dst + x, end - x, clear_color);
+		x = end;
+	}
+}
+
+/* draws the recorded frame into the framebuffer a row at a time. the items
+   on a row are visited front to back, each writing only the pixels nothing
+   in front of it has, until the row is full. the row then goes out as one
+   sequential pass over the framebuffer, with the clear color wherever no
+   item reached; a row no item touches is just a fill. without a clear,
+   pixels no item covers keep what the framebuffer held */
+static void composite(void)
+{
+	if (item_count == 0 && !cleared)
+		return;
+
+	int width = fb_surface.width, words = (width + 31) / 32;
+	color_t *dst = fb_surface.pixels;
+	for (int y = 0; y < (int)fb_surface.height; y++, dst += fb_surface.pitch) {
+		int left = width; // pixels of the row still free
+		bool touched = false;
+		for (int i = item_count - 1; i >= 0 && left > 0; i--) {
+			item_t *it = &items[i];
+			if (y < it->y0 || y >= it->y1)
+				continue;
+			if (!touched) {
+				for (int w = 0; w < words; w++)
+					covered[w] = 0;
+				touched = true;
+			}
+			switch (it->kind) {
+			case ITEM_RECT:
+				left -= cover_span(it->x0, it->x1, NULL, it->u.color);
+				break;
+			case ITEM_SURFACE:
+				left -= cover_span(it->x0, it->x1, it->u.surface.pixels + (y - it->y0) * it->u.surface.pitch, 0);
+				break;
+			case ITEM_SPRITE:
+				left -= cover_sprite(it, y);
+				break;
+			case ITEM_KEYED:
+				left -= cover_keyed(it->x0, it->x1, it->u.surface.pixels + (y - it->y0) * it->u.surface.pitch,
+				                    it->u.surface.key);
+				break;
+			case ITEM_GLYPH:
+				left -= cover_bits(it->x0, (it->u.glyph.rows[y - it->y0] >> it->u.glyph.shift) & it->u.glyph.mask,
+				                   it->u.glyph.color);
+				break;
+			}
+		}
+
+		if (touched)
+			write_row(dst, width);
+		else if (cleared)
+			fill_span(dst, width, clear_color);
+	}
+	item_count = 0;
+	cleared = false;
+}
+
+void gl_set_clip(int x, int y, int w, int h)
+{
+	if (!clip_rect(&x, &y, &w, &h))
+		w = h = 0;
+	clip.x0 = x;
+	clip.y0 = y;
+	clip.x1 = x + w;
+	clip.y1 = y + h;
+}
+
+void gl_get_clip(int *x, int *y, int *w, int *h)
+{
+	*x = clip.x0;
+	*y = clip.y0;
+	*w = clip.x1 - clip.x0;
+	*h = clip.y1 - clip.y0;
+}
+
 void gl_clear(color_t c)
 {
-	// draw over whole screen
-	int size = fb_get_pitch()/4 * fb_get_height();
-	long long c_base = c;
-	long long cc = (c_base << 32) | c_base;
-	unsigned long long *pixel = fb_get_draw_buffer();
-	for (int i = 0; i < size/2; i ++) {
-		//pixel[i] = cc;
-		unsigned long long *pixelset = &pixel[i];
-	    pixelset[0] = cc;
-		pixelset[1] = cc;
-		pixelset[2] = cc;
-		pixelset[3] = cc;
-		pixelset[4] = cc;
-		pixelset[5] = cc;
-		pixelset[6] = cc;
-		pixelset[7] = cc;
+	// everything recorded so far is hidden
+	if (recording()) {
+		item_count = 0;
+		cleared = true;
+		clear_color = c;
+		return;
 	}
+	if (offload(target->width * target->height)) {
+		fb_fence = dma_fill(target->pixels, target->pitch * 4, target->width * 4, target->height, c);
+		return;
+	}
+	flush();
+
+	// draw over whole target, in one run when rows are contiguous
+	if (target->pitch == target->width) {
+		fill_span(target->pixels, target->width * target->height, c);
+		return;
+	}
+	color_t *row = target->pixels;
+	for (int y = 0; y < target->height; y++, row += target->pitch)
+		fill_span(row, target->width, c);
 }
 
 void gl_draw_pixel(int x, int y, color_t c)
 {
-	if (x >= fb_get_width() || y >= fb_get_height())
+	flush();
+	if ((unsigned int)x >= target->width || (unsigned int)y >= target->height)
 		return; //don't draw if out of bounds
-	
-	unsigned int (*pixel)[fb_get_pitch() / 4] = fb_get_draw_buffer();
-	pixel[y][x] = c;
+
+	target->pixels[y * target->pitch + x] = c;
 }
 
 color_t gl_read_pixel(int x, int y)
 {
-	if (x >= fb_get_width() || y >= fb_get_height())
+	flush();
+	if ((unsigned int)x >= target->width || (unsigned int)y >= target->height)
 		return 0; // return 0 if out of bounds
-	
-	unsigned int (*pixel)[fb_get_pitch() / 4] = fb_get_draw_buffer();
-	return (color_t) pixel[y][x];
 
+	return target->pixels[y * target->pitch + x];
 }
 
 void gl_draw_rect(int x, int y, int w, int h, color_t c)
 {
-	// restrict drawing to bounds of screen
-	if (x + w > fb_get_width())
-		w = fb_get_width() - x;
-	if (y + h > fb_get_height())
-		h = fb_get_height() - y;
-	int start_x = x;
-	if (x < 0)
-		start_x = 0;
-	int start_y = y;
-	if (y < 0)
-		start_y = 0;
-
-	unsigned int (*pixel)[fb_get_pitch() / 4] = fb_get_draw_buffer();
-	for (int cur_y = start_y; cur_y < y + h; cur_y++)
-		for (int cur_x = start_x; cur_x < x + w; cur_x++)
-		    pixel[cur_y][cur_x] = c;
-}
-
-void gl_draw_img(int x, int y, const void *img, int scale){
-    struct img_hdr {
-		int width;
-		int height;
-		int bytes_per_pixel; // assume always four
-	};
-	struct img_hdr *hdr = (void *)img;
-	int* image = (int *)(hdr + 1);
-	
-	int width_end = x + (hdr->width * scale);
-	if (width_end > fb_get_width())
-		width_end = fb_get_width();
-	int height_end = y + (hdr->height * scale);
-	if (height_end >fb_get_height())
-		height_end = fb_get_height();
-	int start_x = x;
-	if (x < 0)
-		start_x = 0;
-	int start_y = y;
-	if (y < 0)
-		start_y = 0;
+	// restrict drawing to bounds of target
+	if (!clip_rect(&x, &y, &w, &h))
+		return;
+	if (recording()) {
+		record(ITEM_RECT, x, y, x + w, y + h)->u.color = c;
+		return;
+	}
+	if (offload(w * h)) {
+		fb_fence = dma_fill(target->pixels + y * target->pitch + x, target->pitch * 4, w * 4, h, c);
+		return;
+	}
+	flush();
+
+	color_t *row = target->pixels + y * target->pitch + x;
+	for (int cur_y = 0; cur_y < h; cur_y++, row += target->pitch)
+		fill_span(row, w, c);
+}
+
+/* draws a line that advances one pixel along its major axis per step. a and b
+   are the major and minor start coordinates, da >= db >= 0 the lengths along
+   each axis and sb the minor direction. the strides convert a and b into a
+   pixel offset, so the same loop draws x-major and y-major lines */
+static void draw_line_steps(int a, int b, int da, int db, int sb,
+                            int a_max, int b_max, int a_stride, int b_stride, color_t c)
+{
+	// only step over the part of the major axis that lies in the target
+	int k0 = (a < 0) ? -a : 0;
+	int k1 = (a + da >= a_max) ? a_max - 1 - a : da;
+	if (k0 > k1)
+		return;
+
+	// bresenham error term, jumped ahead to step k0 in one go
+	long long m = ((long long)2 * db * k0 + da - 1) / (2 * da);
+	int err = (int)((long long)2 * db * (k0 + 1) - da - (long long)2 * da * m);
+	b += sb * (int)m;
+
+	color_t *pixels = target->pixels;
+	int offset = (a + k0) * a_stride + b * b_stride;
+	int minor_step = sb * b_stride;
+	for (int k = k0; k <= k1; k++) {
+		if ((unsigned int)b < b_max)
+			pixels[offset] = c;
+		else if ((b < 0) == (sb < 0))
+			return; // moving further away from the target, nothing left to draw
+		if (err > 0) {
+			b += sb;
+			offset += minor_step;
+			err -= 2 * da;
+		}
+		err += 2 * db;
+		offset += a_stride;
+	}
+}
+
+void gl_draw_line(int x1, int y1, int x2, int y2, color_t c)
+{
+	// horizontal and vertical lines are rectangles one pixel thick
+	if (y1 == y2) {
+		if (x1 > x2)
+			gl_draw_rect(x2, y1, x1 - x2 + 1, 1, c);
+		else
+			gl_draw_rect(x1, y1, x2 - x1 + 1, 1, c);
+		return;
+	}
+	if (x1 == x2) {
+		int y = (y1 < y2) ? y1 : y2;
+		int x = x1, w = 1, h = (y1 < y2) ? y2 - y1 + 1 : y1 - y2 + 1;
+		if (!clip_rect(&x, &y, &w, &h))
+			return;
+		flush();
+		color_t *p = target->pixels + y * target->pitch + x;
+		for (; h > 0; h--, p += target->pitch)
+			*p = c;
+		return;
+	}
+
+	flush();
+	int dx = (x2 > x1) ? x2 - x1 : x1 - x2;
+	int dy = (y2 > y1) ? y2 - y1 : y1 - y2;
+	if (dx >= dy) {
+		// x-major: always step left to right
+		if (x1 > x2) {
+			int t = x1; x1 = x2; x2 = t;
+			t = y1; y1 = y2; y2 = t;
+		}
+		draw_line_steps(x1, y1, dx, dy, (y2 > y1) ? 1 : -1,
+		                target->width, target->height, 1, target->pitch, c);
+	} else {
+		// y-major: always step top to bottom
+		if (y1 > y2) {
+			int t = x1; x1 = x2; x2 = t;
+			t = y1; y1 = y2; y2 = t;
+		}
+		draw_line_steps(y1, x1, dy, dx, (x2 > x1) ? 1 : -1,
+		                target->height, target->width, target->pitch, 1, c);
+	}
+}
+
+// pixel coordinate to 16.16 fixed point. edge positions are kept in 64
+// bits: a vertex far off the target does not fit 16.16 in an int
+#define TO_FIXED(n) ((long long)(n) * 65536)
+
+/* 16.16 fixed point x position of the edge a->b on row y */
+static long long edge_x(int xa, int ya, int xb, int yb, int y)
+{
+	if (yb == ya)
+		return TO_FIXED(xa);
+	return TO_FIXED(xa) + TO_FIXED((long long)xb - xa) * ((long long)y - ya) / ((long long)yb - ya);
+}
+
+/* 16.16 fixed point change in x of the edge a->b from one row to the next */
+static long long edge_step(int xa, int ya, int xb, int yb)
+{
+	if (yb == ya)
+		return 0;
+	return TO_FIXED((long long)xb - xa) / ((long long)yb - ya);
+}
+
+/* fills row y between two 16.16 fixed point x positions, rounded to the
+   nearest pixel and clipped to the target */
+static void fill_row(int y, long long xa, long long xb, color_t c)
+{
+	long long left = (xa + 0x8000) >> 16;
+	long long right = (xb + 0x8000) >> 16;
+	if (left > right) {
+		long long t = left; left = right; right = t;
+	}
+	if (left < 0)
+		left = 0;
+	if (right >= (int)target->width)
+		right = target->width - 1;
+	if (left <= right)
+		fill_span(target->pixels + y * target->pitch + left, (int)(right - left + 1), c);
+}
+
+void gl_draw_triangle(int x1, int y1, int x2, int y2, int x3, int y3, color_t c)
+{
+	flush();
+
+	// sort the vertices top to bottom
+	int t;
+	if (y1 > y2) { t = x1; x1 = x2; x2 = t; t = y1; y1 = y2; y2 = t; }
+	if (y2 > y3) { t = x2; x2 = x3; x3 = t; t = y2; y2 = y3; y3 = t; }
+	if (y1 > y2) { t = x1; x1 = x2; x2 = t; t = y1; y1 = y2; y2 = t; }
+
+	if (y3 < 0 || y1 >= (int)target->height)
+		return;
+	if (y1 == y3) { // all on one row
+		int left = x1, right = x1;
+		if (x2 < left) left = x2;
+		if (x3 < left) left = x3;
+		if (x2 > right) right = x2;
+		if (x3 > right) right = x3;
+		fill_row(y1, TO_FIXED(left), TO_FIXED(right), c);
+		return;
+	}
+
+	// walk the long edge 1->3 against the short edges 1->2 then 2->3, one
+	// span per row, in 16.16 fixed point
+	int y = (y1 < 0) ? 0 : y1;
+	int y_end = (y3 >= (int)target->height) ? target->height - 1 : y3;
+	long long long_x = edge_x(x1, y1, x3, y3, y);
+	long long long_step = edge_step(x1, y1, x3, y3);
+	if (y < y2) {
+		long long short_x = edge_x(x1, y1, x2, y2, y);
+		long long short_step = edge_step(x1, y1, x2, y2);
+		for (; y < y2 && y <= y_end; y++) {
+			fill_row(y, long_x, short_x, c);
+			long_x += long_step;
+			short_x += short_step;
+		}
+	}
+	long long short_x = edge_x(x2, y2, x3, y3, y);
+	long long short_step = edge_step(x2, y2, x3, y3);
+	for (; y <= y_end; y++) {
+		fill_row(y, long_x, short_x, c);
+		long_x += long_step;
+		short_x += short_step;
+	}
+}
+
+/* clips a copy of the w x h rectangle at src_x,src_y of src to x,y of the
+   target. returns false if nothing is left to copy */
+static bool clip_blit(int *x, int *y, const gl_surface_t *src, int *src_x, int *src_y, int *w, int *h)
+{
+	// keep the source rectangle inside src
+	if (*src_x < 0) {
+		*x -= *src_x;
+		*w += *src_x;
+		*src_x = 0;
+	}
+	if (*src_y < 0) {
+		*y -= *src_y;
+		*h += *src_y;
+		*src_y = 0;
+	}
+	if (*src_x + *w > (int)src->width)
+		*w = src->width - *src_x;
+	if (*src_y + *h > (int)src->height)
+		*h = src->height - *src_y;
+
+	// then the destination inside the target, moving the source along
+	int old_x = *x, old_y = *y;
+	if (!clip_rect(x, y, w, h))
+		return false;
+	*src_x += *x - old_x;
+	*src_y += *y - old_y;
+	return true;
+}
+
+void gl_blit_surface(int x, int y, const gl_surface_t *src, int src_x, int src_y, int w, int h)
+{
+	if (!clip_blit(&x, &y, src, &src_x, &src_y, &w, &h))
+		return;
+
+	const color_t *from = src->pixels + src_y * src->pitch + src_x;
+	if (recording()) {
+		item_t *it = record(ITEM_SURFACE, x, y, x + w, y + h);
+		it->u.surface.pixels = from;
+		it->u.surface.pitch = src->pitch;
+		return;
+	}
+	if (offload(w * h)) {
+		fb_fence = copy_fence = dma_copy(target->pixels + y * target->pitch + x, target->pitch * 4,
+		                                 from, src->pitch * 4, w * 4, h);
+		return;
+	}
+	flush();
+	color_t *to = target->pixels + y * target->pitch + x;
+	// whole-width copy between surfaces of the same layout is a single run
+	if (w == src->pitch && w == target->pitch) {
+		copy_span(to, from, w * h);
+		return;
+	}
+	for (int row = 0; row < h; row++, from += src->pitch, to += target->pitch)
+		copy_span(to, from, w);
+}
+
+void gl_blit_surface_keyed(int x, int y, const gl_surface_t *src, int src_x, int src_y, int w, int h, color_t key)
+{
+	if (!clip_blit(&x, &y, src, &src_x, &src_y, &w, &h))
+		return;
+
+	const color_t *from = src->pixels + src_y * src->pitch + src_x;
+	if (recording()) {
+		item_t *it = record(ITEM_KEYED, x, y, x + w, y + h);
+		it->u.surface.pixels = from;
+		it->u.surface.pitch = src->pitch;
+		it->u.surface.key = key;
+		return;
+	}
+	flush();
+	color_t *to = target->pixels + y * target->pitch + x;
+	for (int row = 0; row < h; row++, from += src->pitch, to += target->pitch) {
+		for (int col = 0; col < w; col++) {
+			color_t c = from[col];
+			if (c != key)
+				to[col] = c;
+		}
+	}
+}
+
+// on the Pi the ARMv6 path below is the one meant to run, see TARGET_FLAGS
+#if defined(__arm__) && !defined(__linux__) && !(defined(__ARM_ARCH) && __ARM_ARCH >= 6)
+#error "gl.c is built for the ARM1176: compile with -mcpu=arm1176jzf-s"
+#endif
+
+/* adds the four bytes of a and b, each byte clamped at 0xff. ARMv6 does this
+   in one instruction (uqadd8); elsewhere bytes are summed seven bits at a
+   time and the carries out of each byte turned into a saturation mask */
+static inline color_t add_saturate(color_t a, color_t b)
+{
+#if defined(__ARM_ARCH) && __ARM_ARCH >= 6
+	color_t sum;
+	__asm__("uqadd8 %0, %1, %2" : "=r" (sum) : "r" (a), "r" (b));
+	return sum;
+#else
+	color_t sum = (a & 0x7f7f7f7f) + (b & 0x7f7f7f7f);
+	sum ^= (a ^ b) & 0x80808080;
+	color_t carry = ((a & b) | ((a | b) & ~sum)) & 0x80808080;
+	return sum | (carry - (carry >> 7)) | carry;
+#endif
+}
+
+/* premultiplied src over dst. dst is scaled by (255 - alpha) / 255 two
+   channels per multiply (blue and red together, then green and alpha),
+   then src is added on top */
+static inline color_t blend_pixel(color_t dst, color_t src)
+{
+	unsigned int inv = 255 - (src >> 24);
+	unsigned int rb = (dst & 0x00ff00ff) * inv + 0x00800080;
+	rb = ((rb + ((rb >> 8) & 0x00ff00ff)) >> 8) & 0x00ff00ff;
+	unsigned int ag = ((dst >> 8) & 0x00ff00ff) * inv + 0x00800080;
+	ag = (ag + ((ag >> 8) & 0x00ff00ff)) & 0xff00ff00;
+	return add_saturate(rb | ag, src);
+}
+
+/* blends n premultiplied pixels from src over dst. opaque runs are copied and
+   transparent runs skipped, only the pixels in between are blended */
+static void blend_span(color_t *dst, const color_t *src, int n)
+{
 	int i = 0;
-	for (int pixel_y = start_y; pixel_y < height_end; pixel_y += scale) {
-		for (int pixel_x = start_x; pixel_x < width_end; pixel_x += scale) {
-			if (image[i]) {
-				//printf("%x ", image[i]);
-			    gl_draw_rect(pixel_x, pixel_y, scale, scale, image[i]);
+	while (i < n) {
+		unsigned int alpha = src[i] >> 24;
+		int run = i + 1;
+		if (alpha == 0xff) {
+			while (run < n && (src[run] >> 24) == 0xff)
+				run++;
+			copy_span(dst + i, src + i, run - i);
+		} else if (alpha == 0) {
+			while (run < n && (src[run] >> 24) == 0)
+				run++;
+		} else {
+			dst[i] = blend_pixel(dst[i], src[i]);
+		}
+		i = run;
+	}
+}
+
+void gl_blit_surface_alpha(int x, int y, const gl_surface_t *src, int src_x, int src_y, int w, int h)
+{
+	flush();
+	if (!clip_blit(&x, &y, src, &src_x, &src_y, &w, &h))
+		return;
+
+	const color_t *from = src->pixels + src_y * src->pitch + src_x;
+	color_t *to = target->pixels + y * target->pitch + x;
+	for (int row = 0; row < h; row++, from += src->pitch, to += target->pitch)
+		blend_span(to, from, w);
+}
+
+void gl_premultiply(gl_surface_t *s)
+{
+	color_t *row = s->pixels;
+	for (int y = 0; y < s->height; y++, row += s->pitch) {
+		for (int x = 0; x < s->width; x++) {
+			color_t c = row[x];
+			unsigned int a = c >> 24;
+			if (a != 0xff)
+				row[x] = gl_color_alpha(c >> 16, c >> 8, c, a);
+		}
+	}
+}
+
+/* draws sprite pixels first up to last of a row of indices into one target
+   row, expanding each index through the palette. each pixel is scale wide,
+   pixel first starting at column left; only columns lo up to hi are written.
+   with blend, translucent pixels are blended over the target */
+static void draw_span_clipped(color_t *row, int left, const unsigned char *indices, int first, int last,
+                              int scale, const color_t *palette, int lo, int hi, bool blend)
+{
+	for (int x = first; x < last; x++, left += scale) {
+		color_t c = palette[sprite_index(indices, x)];
+		int from = (left < lo) ? lo : left;
+		int to = (left + scale > hi) ? hi : left + scale;
+		if (blend && (c >> 24) != 0xff) {
+			for (int dst_x = from; dst_x < to; dst_x++)
+				row[dst_x] = blend_pixel(row[dst_x], c);
+		} else {
+			for (int dst_x = from; dst_x < to; dst_x++)
+				row[dst_x] = c;
+		}
+	}
+}
+
+/* draws the part src_x,src_y,w,h of sprite img with its upper left at x,y,
+   clipped to the clip rectangle. the clipping is worked out once up front
+   in sprite pixels, so the loops below touch only visible pixels and rows
+   without opaque pixels are skipped outright */
+static void blit_sprite(int x, int y, const gl_sprite_t *img, int src_x, int src_y, int w, int h,
+                        int scale, const color_t *palette, bool blend)
+{
+	if (w <= 0 || h <= 0 || scale <= 0)
+		return;
+
+	// where column and row 0 of the trimmed box land in the target
+	int box_x = x + (img->trim_x - src_x) * scale;
+	int box_y = y + (img->trim_y - src_y) * scale;
+
+	// the source rect in box coordinates, limited to the box
+	int col0 = src_x - img->trim_x, col1 = col0 + w;
+	int row0 = src_y - img->trim_y, row1 = row0 + h;
+	if (col0 < 0)
+		col0 = 0;
+	if (row0 < 0)
+		row0 = 0;
+	if (col1 > img->trim_w)
+		col1 = img->trim_w;
+	if (row1 > img->trim_h)
+		row1 = img->trim_h;
+
+	// then to the columns and rows whose blocks reach into the clip rect
+	if (clip.x1 <= box_x || clip.y1 <= box_y || clip.x0 >= clip.x1 || clip.y0 >= clip.y1)
+		return;
+	if (clip.x0 > box_x && (clip.x0 - box_x) / scale > col0)
+		col0 = (clip.x0 - box_x) / scale;
+	if (clip.y0 > box_y && (clip.y0 - box_y) / scale > row0)
+		row0 = (clip.y0 - box_y) / scale;
+	if ((clip.x1 - box_x + scale - 1) / scale < col1)
+		col1 = (clip.x1 - box_x + scale - 1) / scale;
+	if ((clip.y1 - box_y + scale - 1) / scale < row1)
+		row1 = (clip.y1 - box_y + scale - 1) / scale;
+	if (col0 >= col1 || row0 >= row1)
+		return;
+
+	// opaque sprites go to the compositor, from the first target row that
+	// shows and with the columns limited to the clip rect
+	if (recording() && !blend) {
+		int top = box_y + row0 * scale;
+		int x0 = box_x + col0 * scale, y0 = (top < clip.y0) ? clip.y0 : top;
+		int x1 = box_x + col1 * scale, y1 = box_y + row1 * scale;
+		item_t *it = record(ITEM_SPRITE, (x0 < clip.x0) ? clip.x0 : x0, y0,
+		                    (x1 > clip.x1) ? clip.x1 : x1, (y1 > clip.y1) ? clip.y1 : y1);
+		struct item_sprite *sp = &it->u.sprite;
+		sp->img = img;
+		sp->palette = palette;
+		sp->box_x = box_x;
+		sp->scale = scale;
+		sp->col0 = col0;
+		sp->col1 = col1;
+		sp->next_y = y0;
+		sp->row = row0;
+		sp->sub = y0 - top;
+		return;
+	}
+	flush();
+
+	// generated code for the whole sprite when nothing is clipped
+	if (img->compiled && scale == img->compiled_scale && palette == img->palette && !blend
+		&& col0 == 0 && row0 == 0 && col1 == img->trim_w && row1 == img->trim_h
+		&& box_x >= clip.x0 && box_y >= clip.y0
+		&& box_x + img->trim_w * scale <= clip.x1 && box_y + img->trim_h * scale <= clip.y1) {
+		img->compiled(target->pixels + box_y * target->pitch + box_x, target->pitch);
+		return;
+	}
+
+	const unsigned char *indices = img->indices + row0 * img->stride;
+	for (int row = row0, top = box_y + row0 * scale; row < row1; row++, top += scale, indices += img->stride) {
+		int first_span = img->rows[row], last_span = img->rows[row + 1];
+		if (first_span == last_span)
+			continue;
+		int first = (top < clip.y0) ? clip.y0 : top;
+		int last = (top + scale > clip.y1) ? clip.y1 : top + scale;
+
+		// without blending a sprite row that covers several target rows is
+		// expanded once into the line buffer, which is cached, and copied
+		// from there to each of them. the framebuffer is not cached, so
+		// copying from the row above would read uncached memory
+		bool expand_once = !blend && last - first > 1 && target->width <= fb_surface.width;
+		color_t *dst = target->pixels + first * target->pitch;
+		for (int cur = first; cur < last; cur++, dst += target->pitch) {
+			for (int i = first_span; i < last_span; i++) {
+				gl_span_t span = img->spans[i];
+				int from = (span.x < col0) ? col0 : span.x;
+				int to = (span.x + span.len > col1) ? col1 : span.x + span.len;
+				if (from >= to)
+					continue;
+				if (!expand_once) {
+					draw_span_clipped(dst, box_x + from * scale, indices, from, to, scale, palette,
+					                  clip.x0, clip.x1, blend);
+					continue;
+				}
+				if (cur == first)
+					draw_span_clipped(line, box_x + from * scale, indices, from, to, scale, palette,
+					                  clip.x0, clip.x1, false);
+				int left = box_x + from * scale, right = box_x + to * scale;
+				if (left < clip.x0)
+					left = clip.x0;
+				if (right > clip.x1)
+					right = clip.x1;
+				if (left < right)
+					copy_span(dst + left, line + left, right - left);
 			}
-			    
-			i++;
 		}
 	}
 }
 
+void gl_blit(int x, int y, const gl_sprite_t *img, int src_x, int src_y, int w, int h, int scale)
+{
+	blit_sprite(x, y, img, src_x, src_y, w, h, scale, img->palette, false);
+}
+
+void gl_draw_img(int x, int y, const gl_sprite_t *img, int scale)
+{
+	blit_sprite(x, y, img, 0, 0, img->width, img->height, scale, img->palette, false);
+}
+
+void gl_draw_img_palette(int x, int y, const gl_sprite_t *img, int scale, const color_t *palette)
+{
+	blit_sprite(x, y, img, 0, 0, img->width, img->height, scale, palette, false);
+}
+
+void gl_draw_img_effect(int x, int y, const gl_sprite_t *img, int scale, const gl_effect_t *effect, unsigned int frame)
+{
+	if (frame >= effect->frames)
+		frame = effect->frames - 1;
+	blit_sprite(x, y, img, 0, 0, img->width, img->height, scale, effect->palettes[frame], false);
+}
+
+void gl_draw_img_alpha(int x, int y, const gl_sprite_t *img, int scale)
+{
+	blit_sprite(x, y, img, 0, 0, img->width, img->height, scale, img->palette, true);
+}
+
+/* stores color c at every pixel of dst whose bit is set in bits, bit 0 going
+   to dst[0]. runs of 4 off pixels cost a single test */
+static void draw_bits(color_t *dst, unsigned int bits, color_t c)
+{
+	while (bits) {
+		if (bits & 0xf) {
+			if (bits & 1) dst[0] = c;
+			if (bits & 2) dst[1] = c;
+			if (bits & 4) dst[2] = c;
+			if (bits & 8) dst[3] = c;
+		}
+		bits >>= 4;
+		dst += 4;
+	}
+}
+
 void gl_draw_char(int x, int y, char ch, color_t c)
 {
-	unsigned char buf[font_get_glyph_size()];
-    if (!font_get_glyph(ch, buf, sizeof(buf)))
+	if ((unsigned char)ch >= GLYPH_COUNT)
 		return; //do nothing on unsuccessful char
 
-	// create 2d array for font template, pixels on screen
-	char (* img)[font_get_glyph_width()] = (void *) buf; 
-	unsigned int (*pixel)[fb_get_pitch() / 4] = fb_get_draw_buffer();
-
 	// restrict bounds
-	int width_end = x + font_get_glyph_width();
-	if (width_end > fb_get_width())
-		width_end = fb_get_width();
-	int height_end = y + font_get_glyph_height();
-	if (height_end > fb_get_height())
-		height_end = fb_get_height();
-	int start_x = x;
-	if (x < 0)
-		start_x = 0;
-	int start_y = y;
-	if (y < 0)
-		start_y = 0;
-	
-	for (int pixel_y = start_y; pixel_y < height_end; pixel_y++) {
-		for (int pixel_x = start_x; pixel_x < width_end; pixel_x++) {
-			if (img[pixel_y - y][pixel_x - x]) { // if template pixel on
-				pixel[pixel_y][pixel_x] = c; // draw to screen pixel
-			}
-		}
+	int w = glyph_width, h = glyph_height;
+	int start_x = x, start_y = y;
+	if (!clip_rect(&start_x, &start_y, &w, &h))
+		return;
+
+	// drop the columns clipped off the left and right of each row
+	unsigned int mask = (w == 32) ? ~0U : (1U << w) - 1;
+	int shift = start_x - x;
+	const unsigned int *rows = glyph_atlas + ch * glyph_height + (start_y - y);
+	if (recording()) {
+		item_t *it = record(ITEM_GLYPH, start_x, start_y, start_x + w, start_y + h);
+		it->u.glyph.rows = rows;
+		it->u.glyph.shift = shift;
+		it->u.glyph.mask = mask;
+		it->u.glyph.color = c;
+		return;
 	}
-	
+	flush();
+	color_t *dst = target->pixels + start_y * target->pitch + start_x;
+	for (int row = 0; row < h; row++, dst += target->pitch)
+		draw_bits(dst, (rows[row] >> shift) & mask, c);
 }
 
 void gl_draw_string(int x, int y, const char* str, color_t c)
 {
     while (*str != '\0') {
 		gl_draw_char(x, y, *str, c);
-		x += font_get_glyph_width();
-		if (x > fb_get_width())
+		x += glyph_width;
+		if (x > (int)target->width)
 			return;
 		str++;
 	}
 }
 
+gl_text_t *gl_text_new(unsigned int max_chars, color_t c)
+{
+	gl_text_t *t = malloc(sizeof(gl_text_t) + max_chars + 1);
+	if (!t)
+		return NULL;
+	t->surface = gl_surface_new(max_chars * glyph_width, glyph_height);
+	if (!t->surface) {
+		free(t);
+		return NULL;
+	}
+	t->color = c;
+	t->max_chars = max_chars;
+	t->width = 0;
+	t->str[0] = '\0';
+	return t;
+}
+
+void gl_text_free(gl_text_t *t)
+{
+	if (!t)
+		return;
+	gl_surface_free(t->surface);
+	free(t);
+}
+
+void gl_text_set(gl_text_t *t, const char *str)
+{
+	// nothing to render if the (truncated) string is unchanged
+	int n = 0;
+	while (n < t->max_chars && str[n] != '\0' && str[n] == t->str[n])
+		n++;
+	if ((n == t->max_chars || str[n] == '\0') && t->str[n] == '\0')
+		return;
+
+	for (n = 0; n < t->max_chars && str[n] != '\0'; n++)
+		t->str[n] = str[n];
+	t->str[n] = '\0';
+
+	t->width = n * glyph_width;
+
+	gl_surface_t *prev = gl_get_target();
+	int x, y, w, h;
+	gl_get_clip(&x, &y, &w, &h);
+	gl_set_target(t->surface);
+	gl_clear(0);
+	gl_draw_string(0, 0, t->str, t->color);
+	gl_set_target(prev);
+	gl_set_clip(x, y, w, h);
+}
+
+void gl_draw_text(int x, int y, const gl_text_t *t)
+{
+	gl_blit_surface_keyed(x, y, t->surface, 0, 0, t->width, t->surface->height, 0);
+}
+
 unsigned int gl_get_char_height(void)
 {
-    return font_get_glyph_height();
+    return glyph_height;
 }
 
 unsigned int gl_get_char_width(void)
 {
-    return font_get_glyph_width();
+    return glyph_width;
 }
@@ -8,6 +8,10 @@
  * access and configuration; trying to use both fb and gl
  * simultaneously is discouraged.
  *
+ * Drawing goes to the framebuffer unless an off-screen surface has
+ * been selected with `gl_set_target`, in which case the bounds below
+ * refer to that surface instead.
+ *
  * Students implement this module in assignment 6 (text and rectangles
  * are required, lines and triangles are an extension).
  *
@@ -19,6 +23,11 @@
 
 typedef enum { GL_SINGLEBUFFER = FB_SINGLEBUFFER, GL_DOUBLEBUFFER = FB_DOUBLEBUFFER } gl_mode_t;
 
+// or-ed into the mode given to `gl_init` to select the span compositor
+#define GL_COMPOSITE 0x100
+// or-ed into the mode given to `gl_init` to hand large fills and copies to DMA
+#define GL_DMA 0x200
+
 /*
  * `gl_init` : Required initialized for graphics library
  *
@@ -26,11 +35,41 @@ typedef enum { GL_SINGLEBUFFER = FB_SINGLEBUFFER, GL_DOUBLEBUFFER = FB_DOUBLEBUF
  * to initialize the framebuffer. The framebuffer will be initialzed to
  * 4-byte depth (32 bits per pixel).
  *
+ * With GL_COMPOSITE or-ed into the mode, drawing into the framebuffer
+ * goes through the span compositor instead of straight to its pixels.
+ * `gl_clear`, `gl_draw_rect`, `gl_blit_surface`, `gl_blit_surface_keyed`
+ * (and so `gl_draw_text`), characters, strings, horizontal lines and
+ * opaque sprites are then only recorded, and the frame is put together
+ * at `gl_swap_buffer` one row at a time: the recorded items are resolved
+ * front to back, so a pixel hidden by a later item is never written,
+ * and each framebuffer row is stored exactly once, in address order.
+ * Recorded sprites and surfaces are read when the frame is composited.
+ * Selecting a recorded surface with `gl_set_target` or freeing it first
+ * composites what was recorded so far, so it may be drawn into again
+ * within the frame; its pixels must not be changed any other way before
+ * `gl_swap_buffer`.
+ *
+ * The remaining calls that touch the framebuffer (`gl_draw_pixel`,
+ * `gl_read_pixel`, other lines, triangles, `gl_blit_surface_alpha` and
+ * `gl_draw_img_alpha`) cannot be recorded. Each one ends the span pass:
+ * what was recorded so far is composited first, and whatever is drawn
+ * after it is composited again at the swap, so those rows are written
+ * more than once. Draw them last in a frame to keep to a single pass.
+ * Off-screen targets are always drawn directly.
+ *
+ * With GL_DMA, `gl_clear` and large `gl_draw_rect` fills and
+ * `gl_blit_surface` copies into the framebuffer are queued on the DMA
+ * controller (see dma.h) and return at once, so the CPU can go on with
+ * other work while the buffer is filled. gl waits for the queued work
+ * before the CPU next draws into the framebuffer, before `gl_swap_buffer`
+ * shows it and before a surface copied from is drawn into or freed.
+ *
  * @param width  the requested width in pixels of the framebuffer
  * @param height the requested height in pixels of the framebuffer
  * @param mode   whether the framebuffer should be
  *                  single buffered (GL_SINGLEBUFFER)
- *                  or double buffered (GL_DOUBLEBUFFER)
+ *                  or double buffered (GL_DOUBLEBUFFER),
+ *                  optionally or-ed with GL_COMPOSITE and GL_DMA
  */
 void gl_init(unsigned int width, unsigned int height, gl_mode_t mode);
 
@@ -98,12 +137,28 @@ typedef unsigned int color_t;
  */
 color_t gl_color(unsigned char r, unsigned char g, unsigned char b);
 
+/*
+ * `gl_color_alpha`
+ *
+ * Returns a partially transparent color in premultiplied form, the
+ * form expected by the alpha blending functions: each of r, g and b
+ * is scaled by a/255 and a is stored in the alpha component.
+ *
+ * @param r  the red component of the color
+ * @param g  the green component of the color
+ * @param b  the blue component of the color
+ * @param a  the opacity, from 0 (transparent) to 0xff (opaque)
+ *
+ * @return   the premultiplied color as a single value of type color_t
+ */
+color_t gl_color_alpha(unsigned char r, unsigned char g, unsigned char b, unsigned char a);
+
 /*
  * `gl_clear`
  *
- * Clear all the pixels in the framebuffer to the given color.
+ * Clear all the pixels in the current draw target to the given color.
  *
- * @param c  the color drawn into the framebuffer
+ * @param c  the color drawn into the target
  */
 void gl_clear(color_t c);
 
@@ -117,9 +172,149 @@ void gl_clear(color_t c);
  *
  * If not in double-buffer mode, all drawing takes place on-screen and
  * the `gl_swap_buffer` function has no effect.
+ *
+ * With GL_COMPOSITE, the frame recorded since the last swap is
+ * composited into the draw buffer first.
  */
 void gl_swap_buffer(void);
 
+/*
+ * `gl_surface_t`
+ *
+ * An off-screen drawing surface held in ordinary RAM. Pixels are
+ * stored row by row as color_t values; `pitch` is the number of
+ * pixels (not bytes) from the start of one row to the start of the next.
+ */
+typedef struct {
+	unsigned int width;
+	unsigned int height;
+	unsigned int pitch;
+	color_t *pixels;
+} gl_surface_t;
+
+/*
+ * `gl_surface_new`
+ *
+ * Allocate a new surface of the given size. The contents of the
+ * surface are not initialized; call `gl_clear` on it before use.
+ *
+ * @param width   the width in pixels of the surface
+ * @param height  the height in pixels of the surface
+ *
+ * @return        the new surface, or NULL if out of memory
+ */
+gl_surface_t *gl_surface_new(unsigned int width, unsigned int height);
+
+/*
+ * `gl_surface_free`
+ *
+ * Release a surface allocated by `gl_surface_new`. If the surface is
+ * the current draw target, drawing reverts to the framebuffer.
+ *
+ * @param s  the surface to free
+ */
+void gl_surface_free(gl_surface_t *s);
+
+/*
+ * `gl_set_target`
+ *
+ * Direct all subsequent drawing (clear, pixels, rectangles, images,
+ * text, ...) into surface s instead of the framebuffer. Clipping is
+ * done against the bounds of the target surface. Pass NULL to draw
+ * into the framebuffer again.
+ *
+ * @param s  the surface to draw into, or NULL for the framebuffer
+ */
+void gl_set_target(gl_surface_t *s);
+
+/*
+ * `gl_get_target`
+ *
+ * Get the surface currently being drawn into. When drawing into the
+ * framebuffer, this describes the current draw buffer.
+ *
+ * @return  the current draw target
+ */
+gl_surface_t *gl_get_target(void);
+
+/*
+ * `gl_set_clip`
+ *
+ * Restrict sprite drawing (`gl_blit` and the `gl_draw_img` functions)
+ * to the w x h rectangle at x,y of the target. The rectangle is
+ * intersected with the bounds of the target. Selecting a target with
+ * `gl_set_target` resets the clip rectangle to the whole target.
+ *
+ * @param x  the x location of the upper left corner of the rectangle
+ * @param y  the y location of the upper left corner of the rectangle
+ * @param w  the width of the rectangle
+ * @param h  the height of the rectangle
+ */
+void gl_set_clip(int x, int y, int w, int h);
+
+/*
+ * `gl_get_clip`
+ *
+ * Get the current clip rectangle, as set by `gl_set_clip` or
+ * `gl_set_target`. The rectangle always lies within the target and has
+ * zero width and height if nothing is drawn.
+ *
+ * @param x  set to the x location of the upper left corner
+ * @param y  set to the y location of the upper left corner
+ * @param w  set to the width of the rectangle
+ * @param h  set to the height of the rectangle
+ */
+void gl_get_clip(int *x, int *y, int *w, int *h);
+
+/*
+ * `gl_blit_surface`
+ *
+ * Copy the w x h rectangle at src_x,src_y of surface src to location
+ * x,y of the current target. The source rectangle is clipped to the
+ * bounds of src and the destination to the bounds of the target.
+ *
+ * @param x      the x location in the target of the upper left corner
+ * @param y      the y location in the target of the upper left corner
+ * @param src    the surface to copy from
+ * @param src_x  the x location in src of the rectangle to copy
+ * @param src_y  the y location in src of the rectangle to copy
+ * @param w      the width of the rectangle to copy
+ * @param h      the height of the rectangle to copy
+ */
+void gl_blit_surface(int x, int y, const gl_surface_t *src, int src_x, int src_y, int w, int h);
+
+/*
+ * `gl_blit_surface_keyed`
+ *
+ * Same as `gl_blit_surface`, except that source pixels equal to
+ * the color key are treated as transparent and are not copied.
+ *
+ * @param key  the color in src that is not copied
+ */
+void gl_blit_surface_keyed(int x, int y, const gl_surface_t *src, int src_x, int src_y, int w, int h, color_t key);
+
+/*
+ * `gl_blit_surface_alpha`
+ *
+ * Same as `gl_blit_surface`, except that the pixels of src are
+ * premultiplied colors that are blended over the target according to
+ * their alpha: alpha 0xff replaces the target pixel, alpha 0 leaves it
+ * as-is, anything in between mixes the two. Runs of opaque and
+ * transparent pixels are copied or skipped without blending.
+ */
+void gl_blit_surface_alpha(int x, int y, const gl_surface_t *src, int src_x, int src_y, int w, int h);
+
+/*
+ * `gl_premultiply`
+ *
+ * Convert every pixel of surface s from a straight color, such as
+ * one built by `gl_color` or loaded from an image, to the premultiplied
+ * form used by `gl_blit_surface_alpha`.
+ *
+ * @param s  the surface to convert in place
+ */
+void gl_premultiply(gl_surface_t *s);
+
 /*
  * `gl_draw_pixel`
  *
@@ -160,11 +355,137 @@ color_t gl_read_pixel(int x, int y);
  *            in the current font, nothing is drawn (refer to font_get_glyph())
  * @param c   the color of the character
  */
+void gl_draw_char(int x, int y, char ch, color_t c);
+
+/*
+ * `gl_span_t`
+ *
+ * A run of len opaque pixels starting at column x of a sprite row.
+ */
+typedef struct {
+	unsigned char x;
+	unsigned char len;
+} gl_span_t;
 
-void gl_draw_img(int x, int y, const void *img, int scale);
+/*
+ * `gl_sprite_t`
+ *
+ * A sprite in the native format written by tools/spritegen.py. The
+ * pixels are stored only for the trimmed box around the opaque part
+ * of the image, as 4-bit indices into a palette of 16 colors, with
+ * rows of the box stride bytes apart. The generated sprites all share
+ * one sheet of indices, so stride is the width of the sheet. The left
+ * pixel of each pair is in the low nibble. Index 0 is transparent; the
+ * palette colors
+ * are in framebuffer order and premultiplied by alpha. The spans of
+ * row y of the box are spans[rows[y]] up to spans[rows[y + 1]]. mask
+ * has one word per row of the box with bit x set when pixel x is opaque.
+ * The pivot and collider box are in pixels of the whole image; gl does
+ * not use them itself.
+ *
+ * compiled, if not NULL, is straight-line code generated for the sprite
+ * that stores its opaque pixels drawn at compiled_scale, with dst the
+ * upper left of the scaled trimmed box and pitch the distance in pixels
+ * between target rows. It does no clipping.
+ */
+typedef struct {
+	unsigned short width, height;   // size of the whole image
+	unsigned short trim_x, trim_y;  // position of the trimmed box in the image
+	unsigned short trim_w, trim_h;  // size of the trimmed box
+	const unsigned char *indices;   // 4-bit palette index per pixel of the box
+	unsigned short stride;          // bytes from one row of indices to the next
+	const color_t *palette;         // 16 colors, entry 0 unused
+	const unsigned short *rows;     // trim_h + 1 indexes into spans
+	const gl_span_t *spans;         // opaque runs, x relative to the box
+	const unsigned int *mask;       // collision mask, trim_h words
+	short pivot_x, pivot_y;         // point the sprite is placed and turned around
+	unsigned short collider_x, collider_y;  // box used for hit tests
+	unsigned short collider_w, collider_h;
+	void (*compiled)(color_t *dst, int pitch);
+	unsigned short compiled_scale;
+} gl_sprite_t;
 
+/*
+ * `gl_draw_img`
+ *
+ * Draw sprite img with its upper left corner at location x,y, each
+ * sprite pixel drawn as a scale x scale block. Only the opaque pixels
+ * are drawn, and only those that lie within the clip rectangle, which
+ * is the whole target unless set with `gl_set_clip`. A sprite that has
+ * compiled code for this scale and lies entirely within the clip
+ * rectangle is drawn by that code.
+ *
+ * @param x      the x location of the upper left corner of the image
+ * @param y      the y location of the upper left corner of the image
+ * @param img    the sprite to draw
+ * @param scale  the size in pixels of each sprite pixel
+ */
+void gl_draw_img(int x, int y, const gl_sprite_t *img, int scale);
 
-void gl_draw_char(int x, int y, char ch, color_t c);
+/*
+ * `gl_blit`
+ *
+ * Draw the w x h part of sprite img whose upper left is at src_x,src_y
+ * of the image, with that corner at location x,y and each sprite pixel
+ * drawn as a scale x scale block. Only the opaque pixels are drawn, and
+ * only those that lie within the clip rectangle (see `gl_set_clip`).
+ * The cost is proportional to the visible part alone. `gl_draw_img` is
+ * the same as blitting the whole image.
+ *
+ * @param x      the x location in the target for the corner src_x,src_y
+ * @param y      the y location in the target for the corner src_x,src_y
+ * @param img    the sprite to draw from
+ * @param src_x  the x location of the part within the image
+ * @param src_y  the y location of the part within the image
+ * @param w      the width of the part, in sprite pixels
+ * @param h      the height of the part, in sprite pixels
+ * @param scale  the size in pixels of each sprite pixel
+ */
+void gl_blit(int x, int y, const gl_sprite_t *img, int src_x, int src_y, int w, int h, int scale);
+
+/*
+ * `gl_draw_img_alpha`
+ *
+ * Same as `gl_draw_img`, except that partially transparent pixels are
+ * blended over the target according to their alpha, the same way as
+ * `gl_blit_surface_alpha`.
+ */
+void gl_draw_img_alpha(int x, int y, const gl_sprite_t *img, int scale);
+
+/*
+ * `gl_draw_img_palette`
+ *
+ * Same as `gl_draw_img`, except that the sprite's palette indices are
+ * looked up in the given palette instead of the sprite's own. This
+ * recolors a sprite at no extra cost per pixel.
+ *
+ * @param palette  16 colors replacing img->palette, entry 0 unused
+ */
+void gl_draw_img_palette(int x, int y, const gl_sprite_t *img, int scale, const color_t *palette);
+
+/*
+ * `gl_effect_t`
+ *
+ * A palette effect, such as a hit flash or a fade, written by
+ * tools/spritegen.py from art/effects.txt. Frame i of the effect
+ * recolors any sprite that uses the shared sprite palette by drawing
+ * it with palettes[i].
+ */
+typedef struct {
+	unsigned int frames;
+	const color_t (*palettes)[16];
+} gl_effect_t;
+
+/*
+ * `gl_draw_img_effect`
+ *
+ * Draw sprite img recolored by the given frame of effect. Frames past
+ * the end of the effect draw its last frame.
+ *
+ * @param effect  the effect to apply
+ * @param frame   the frame of the effect, counting from 0
+ */
+void gl_draw_img_effect(int x, int y, const gl_sprite_t *img, int scale, const gl_effect_t *effect, unsigned int frame);
 
 /*
  * `gl_draw_string`
@@ -200,6 +521,61 @@ unsigned int gl_get_char_height(void);
  */
 unsigned int gl_get_char_width(void);
 
+/*
+ * `gl_text_t`
+ *
+ * A string pre-rendered into an off-screen surface. Use it for text
+ * that is drawn every frame but rarely changes: the glyphs are only
+ * rendered again when the string is changed with `gl_text_set`.
+ */
+typedef struct gl_text gl_text_t;
+
+/*
+ * `gl_text_new`
+ *
+ * Create a text object that can hold up to max_chars characters
+ * drawn in color c. The text starts out empty. Color c must not be
+ * 0, which is used to mark the pixels between glyphs.
+ *
+ * @param max_chars  the longest string the object can hold
+ * @param c          the color of the text
+ *
+ * @return           the new text object, or NULL if out of memory
+ */
+gl_text_t *gl_text_new(unsigned int max_chars, color_t c);
+
+/*
+ * `gl_text_free`
+ *
+ * Release a text object created by `gl_text_new`.
+ *
+ * @param t  the text object to free
+ */
+void gl_text_free(gl_text_t *t);
+
+/*
+ * `gl_text_set`
+ *
+ * Change the string held by text object t. Characters past max_chars
+ * are dropped. Nothing is rendered if str equals the current string.
+ *
+ * @param t    the text object
+ * @param str  the null-terminated string
+ */
+void gl_text_set(gl_text_t *t, const char *str);
+
+/*
+ * `gl_draw_text`
+ *
+ * Draw the pre-rendered string of text object t at location x,y.
+ * Clipping and transparency are the same as for `gl_draw_string`.
+ *
+ * @param x  the x location of the upper left corner of the first char
+ * @param y  the y location of the upper left corner of the first char
+ * @param t  the text object to draw
+ */
+void gl_draw_text(int x, int y, const gl_text_t *t);
+
 /*
  * `gl_draw_rect`
  *
@@ -216,7 +592,7 @@ unsigned int gl_get_char_width(void);
 void gl_draw_rect(int x, int y, int w, int h, color_t c);
 
 /*
- * `gl_draw_line`: optional extension
+ * `gl_draw_line`
  *
  * Draw a line segment from location x1,y1 to location x2,y2 of color c.
  * All pixels along the line that lie within the bounds of the framebuffer
@@ -227,14 +603,11 @@ void gl_draw_rect(int x, int y, int w, int h, color_t c);
  * @param x2  the x location of vertex 2
  * @param y2  the y location of vertex 2
  * @param c   the color of the line
- *
- * This function is NOT part of the core requirements.
- * You can leave this function unimplemented if not doing the extension.
  */
 void gl_draw_line(int x1, int y1, int x2, int y2, color_t c);
 
 /*
- * `gl_draw_triangle`: optional extension
+ * `gl_draw_triangle`
  *
  * Draw a filled triangle connecting the three vertices filled with color c.
  * All pixels within the triangle that lie within the bounds of the
@@ -247,9 +620,6 @@ void gl_draw_line(int x1, int y1, int x2, int y2, color_t c);
  * @param x3  the x location of vertex 3
  * @param y3  the y location of vertex 3
  * @param c   the color of the triangle
- *
- * This function is NOT part of the core requirements.
- * You can leave this function unimplemented if not doing the extension.
  */
 void gl_draw_triangle(int x1, int y1, int x2, int y2, int x3, int y3, color_t c);
 
@@ -0,0 +1,150 @@
+#include "gl_cmd.h"
+#include "assert.h"
+#include <stdbool.h>
+
+typedef enum { CMD_SPRITE, CMD_RECT, CMD_TEXT } cmd_kind_t;
+
+typedef struct {
+	cmd_kind_t kind;
+	int layer;
+	int x, y;                  // where the command draws
+	int x0, y0, x1, y1;        // the box it may cover, x1,y1 exclusive
+	unsigned int key;          // offset of its upper left pixel, set by submit
+	union {
+		struct {
+			const gl_sprite_t *img;
+			const color_t *palette;
+			int scale;
+		} sprite;
+		color_t color;         // CMD_RECT
+		struct {
+			const char *str;
+			color_t color;
+		} text;
+	} u;
+} cmd_t;
+
+static cmd_t cmds[GL_CMD_MAX];
+static int cmd_count;
+static cmd_t *order[GL_CMD_MAX]; // the commands left to draw, in drawing order
+
+static cmd_t *new_cmd(cmd_kind_t kind, int layer, int x, int y, int w, int h)
+{
+	assert(cmd_count < GL_CMD_MAX);
+	cmd_t *cmd = &cmds[cmd_count++];
+	cmd->kind = kind;
+	cmd->layer = layer;
+	cmd->x = x;
+	cmd->y = y;
+	cmd->x0 = x;
+	cmd->y0 = y;
+	cmd->x1 = x + w;
+	cmd->y1 = y + h;
+	return cmd;
+}
+
+void gl_cmd_sprite_palette(int layer, int x, int y, const gl_sprite_t *img, int scale,
+                           const color_t *palette)
+{
+	// only the trimmed box of the sprite holds opaque pixels
+	cmd_t *cmd = new_cmd(CMD_SPRITE, layer, x + img->trim_x * scale, y + img->trim_y * scale,
+	                     img->trim_w * scale, img->trim_h * scale);
+	cmd->x = x;
+	cmd->y = y;
+	cmd->u.sprite.img = img;
+	cmd->u.sprite.palette = palette;
+	cmd->u.sprite.scale = scale;
+}
+
+void gl_cmd_sprite(int layer, int x, int y, const gl_sprite_t *img, int scale)
+{
+	gl_cmd_sprite_palette(layer, x, y, img, scale, img->palette);
+}
+
+void gl_cmd_rect(int layer, int x, int y, int w, int h, color_t c)
+{
+	new_cmd(CMD_RECT, layer, x, y, w, h)->u.color = c;
+}
+
+void gl_cmd_text(int layer, int x, int y, const char *str, color_t c)
+{
+	int len = 0;
+	while (str[len])
+		len++;
+	cmd_t *cmd = new_cmd(CMD_TEXT, layer, x, y, len * gl_get_char_width(), gl_get_char_height());
+	cmd->u.text.str = str;
+	cmd->u.text.color = c;
+}
+
+/* true if a draws before b: by layer, then by address */
+static bool before(const cmd_t *a, const cmd_t *b)
+{
+	return a->layer < b->layer || (a->layer == b->layer && a->key < b->key);
+}
+
+/* true if rectangle b continues rectangle a to the right or downward, so
+   the two can be filled as one */
+static bool continues(const cmd_t *a, const cmd_t *b)
+{
+	if (b->kind != CMD_RECT || b->layer != a->layer || b->u.color != a->u.color)
+		return false;
+	return (b->y0 == a->y0 && b->y1 == a->y1 && b->x0 == a->x1)
+		|| (b->x0 == a->x0 && b->x1 == a->x1 && b->y0 == a->y1);
+}
+
+void gl_cmd_submit(void)
+{
+	const gl_surface_t *target = gl_get_target();
+	int clip_x, clip_y, clip_w, clip_h;
+	gl_get_clip(&clip_x, &clip_y, &clip_w, &clip_h);
+
+	// cull what cannot show: sprites are drawn only within the clip
+	// rectangle, fills anywhere on the target. the rest are keyed by the
+	// address of the first pixel that shows
+	int n = 0;
+	for (int i = 0; i < cmd_count; i++) {
+		cmd_t *cmd = &cmds[i];
+		int x0 = 0, y0 = 0, x1 = target->width, y1 = target->height;
+		if (cmd->kind == CMD_SPRITE) {
+			x0 = clip_x;
+			y0 = clip_y;
+			x1 = clip_x + clip_w;
+			y1 = clip_y + clip_h;
+		}
+		if (cmd->x0 >= cmd->x1 || cmd->y0 >= cmd->y1
+			|| cmd->x1 <= x0 || cmd->y1 <= y0 || cmd->x0 >= x1 || cmd->y0 >= y1)
+			continue;
+		int x = (cmd->x0 < x0) ? x0 : cmd->x0;
+		int y = (cmd->y0 < y0) ? y0 : cmd->y0;
+		cmd->key = y * target->pitch + x;
+
+		// insertion sort, stable so equal keys keep their recorded order
+		int j = n++;
+		for (; j > 0 && before(cmd, order[j - 1]); j--)
+			order[j] = order[j - 1];
+		order[j] = cmd;
+	}
+
+	for (int i = 0; i < n; i++) {
+		cmd_t *cmd = order[i];
+		switch (cmd->kind) {
+		case CMD_SPRITE:
+			gl_draw_img_palette(cmd->x, cmd->y, cmd->u.sprite.img, cmd->u.sprite.scale,
+			                    cmd->u.sprite.palette);
+			break;
+		case CMD_RECT:
+			// grow the rectangle over the fills that continue it
+			while (i + 1 < n && continues(cmd, order[i + 1])) {
+				cmd->x1 = order[i + 1]->x1;
+				cmd->y1 = order[i + 1]->y1;
+				i++;
+			}
+			gl_draw_rect(cmd->x0, cmd->y0, cmd->x1 - cmd->x0, cmd->y1 - cmd->y0, cmd->u.color);
+			break;
+		case CMD_TEXT:
+			gl_draw_string(cmd->x, cmd->y, cmd->u.text.str, cmd->u.text.color);
+			break;
+		}
+	}
+	cmd_count = 0;
+}
@@ -0,0 +1,75 @@
+#ifndef GL_CMD_H
+#define GL_CMD_H
+
+/*
+ * Display list for a frame of drawing.
+ *
+ * Instead of drawing right away, the `gl_cmd` functions record commands
+ * into a buffer that `gl_cmd_submit` then works through as a whole: it
+ * drops commands that cannot show (sprites outside the clip rectangle,
+ * anything else outside the target), sorts the rest by layer and then
+ * by the address of their upper left pixel, merges fills that continue
+ * one another into one rectangle and draws the result with the
+ * ordinary gl functions. Since the whole frame is known before anything
+ * is drawn, submit is also the place to track dirty regions or hand
+ * work to DMA.
+ *
+ * Commands on a lower layer are drawn first. Within a layer they are
+ * drawn in address order rather than the order they were recorded, so
+ * commands that overlap should go on different layers.
+ */
+
+#include "gl.h"
+
+// most commands a frame may record
+#define GL_CMD_MAX 256
+
+/*
+ * `gl_cmd_sprite`
+ *
+ * Record drawing sprite img at x,y, as `gl_draw_img` does.
+ *
+ * @param layer  the layer of the command, lower layers are drawn first
+ */
+void gl_cmd_sprite(int layer, int x, int y, const gl_sprite_t *img, int scale);
+
+/*
+ * `gl_cmd_sprite_palette`
+ *
+ * Record drawing sprite img at x,y with a different palette, as
+ * `gl_draw_img_palette` does.
+ *
+ * @param layer  the layer of the command, lower layers are drawn first
+ */
+void gl_cmd_sprite_palette(int layer, int x, int y, const gl_sprite_t *img, int scale,
+                           const color_t *palette);
+
+/*
+ * `gl_cmd_rect`
+ *
+ * Record a filled rectangle, as `gl_draw_rect` draws.
+ *
+ * @param layer  the layer of the command, lower layers are drawn first
+ */
+void gl_cmd_rect(int layer, int x, int y, int w, int h, color_t c);
+
+/*
+ * `gl_cmd_text`
+ *
+ * Record a string, as `gl_draw_string` draws. Only the pointer is kept,
+ * so str must not change before the list is submitted.
+ *
+ * @param layer  the layer of the command, lower layers are drawn first
+ */
+void gl_cmd_text(int layer, int x, int y, const char *str, color_t c);
+
+/*
+ * `gl_cmd_submit`
+ *
+ * Draw the commands recorded since the last submit into the current gl
+ * target, culled, sorted and merged as described above, and empty the
+ * list. Sprites are clipped to the clip rectangle in effect at submit.
+ */
+void gl_cmd_submit(void);
+
+#endif
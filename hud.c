@@ -0,0 +1,136 @@
+#include "hud.h"
+#include "assert.h"
+#include <stdbool.h>
+
+// label positions within the banner, same layout as the old per-frame drawing
+#define POINTS_X 10
+#define HIGH_SCORE_X 425
+#define TEXT_Y 10
+
+// longest formatted int: "-2147483648"
+#define MAX_DIGITS 11
+
+typedef struct {
+	int x;                    // where the first digit goes in the strip
+	int value;
+	char shown[MAX_DIGITS + 1]; // digits rendered in the strip, null padded
+} counter_t;
+
+static gl_surface_t *strip;
+static color_t background_color;
+static color_t border_color;
+static int inner_right; // first column of the right border
+static color_t text_color;
+static counter_t points_counter;
+static counter_t high_score_counter;
+
+/* writes the decimal digits of val into buf with a terminating null and returns
+   the length. digits come from repeated subtraction of powers of ten, so there
+   are no calls into the software divide */
+static int format_int(char *buf, int val)
+{
+	static const unsigned int powers[] = {
+		1000000000, 100000000, 10000000, 1000000, 100000,
+		10000, 1000, 100, 10, 1
+	};
+	int len = 0;
+	unsigned int u = val;
+	if (val < 0) {
+		buf[len++] = '-';
+		u = -u;
+	}
+	bool leading = true;
+	for (int i = 0; i < sizeof(powers) / sizeof(powers[0]); i++) {
+		char digit = '0';
+		while (u >= powers[i]) {
+			u -= powers[i];
+			digit++;
+		}
+		if (digit != '0' || !leading || powers[i] == 1) {
+			buf[len++] = digit;
+			leading = false;
+		}
+	}
+	buf[len] = '\0';
+	return len;
+}
+
+/* redraws only the character cells of counter c that differ from the new value */
+static void counter_set(counter_t *c, int value)
+{
+	if (value == c->value)
+		return;
+	c->value = value;
+
+	// pad with nulls so cells past the end of either string compare cleanly
+	char digits[MAX_DIGITS + 1] = {0};
+	format_int(digits, value);
+
+	gl_surface_t *prev = gl_get_target();
+	gl_set_target(strip);
+	int w = gl_get_char_width();
+	for (int i = 0; i < MAX_DIGITS; i++) {
+		if (digits[i] == c->shown[i])
+			continue;
+		// clear the old digit without eating into the border
+		int cell_x = c->x + i * w;
+		int cell_w = (cell_x + w > inner_right) ? inner_right - cell_x : w;
+		gl_draw_rect(cell_x, TEXT_Y, cell_w, gl_get_char_height(), background_color);
+		if (digits[i])
+			gl_draw_char(c->x + i * w, TEXT_Y, digits[i], text_color);
+		c->shown[i] = digits[i];
+	}
+	// a counter too long for the banner is cut off at the border
+	if (c->x + MAX_DIGITS * w > inner_right)
+		gl_draw_rect(inner_right, 0, strip->width - inner_right, strip->height, border_color);
+	gl_set_target(prev);
+}
+
+static void counter_init(counter_t *c, int x, const char *label)
+{
+	gl_draw_string(x, TEXT_Y, label, text_color);
+	int len = 0;
+	while (label[len])
+		len++;
+	c->x = x + len * gl_get_char_width();
+	c->value = 0;
+	for (int i = 0; i <= MAX_DIGITS; i++)
+		c->shown[i] = '\0';
+	c->shown[0] = '0';
+	gl_draw_char(c->x, TEXT_Y, '0', text_color);
+}
+
+void hud_init(unsigned int width, unsigned int height, unsigned int border_width,
+              color_t border, color_t background, color_t text)
+{
+	gl_surface_free(strip);
+	strip = gl_surface_new(width, height);
+	assert(strip);
+	border_color = border;
+	background_color = background;
+	inner_right = width - border_width;
+	text_color = text;
+
+	gl_surface_t *prev = gl_get_target();
+	gl_set_target(strip);
+	gl_clear(border);
+	gl_draw_rect(border_width, border_width, width - 2 * border_width, height - 2 * border_width, background);
+	counter_init(&points_counter, POINTS_X, "POINTS: ");
+	counter_init(&high_score_counter, HIGH_SCORE_X, "HIGH SCORE: ");
+	gl_set_target(prev);
+}
+
+void hud_set_points(int points)
+{
+	counter_set(&points_counter, points);
+}
+
+void hud_set_high_score(int high_score)
+{
+	counter_set(&high_score_counter, high_score);
+}
+
+void hud_draw(void)
+{
+	gl_blit_surface(0, 0, strip, 0, 0, strip->width, strip->height);
+}
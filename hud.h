@@ -0,0 +1,54 @@
+#ifndef HUD_H
+#define HUD_H
+
+/*
+ * Retained heads-up display for the score banner at the top of the
+ * screen. The banner (border, background, labels and counters) is kept
+ * rendered in an off-screen strip; setting a counter redraws only the
+ * digits that changed, and drawing the banner is a single strip copy.
+ */
+
+#include "gl.h"
+
+/*
+ * `hud_init`
+ *
+ * Render the banner into its strip. Must be called after `gl_init`.
+ * Both counters start out at 0.
+ *
+ * @param width         the width in pixels of the banner
+ * @param height        the height in pixels of the banner
+ * @param border_width  the thickness in pixels of the border
+ * @param border        the color of the border
+ * @param background    the color inside the border
+ * @param text          the color of the labels and counters
+ */
+void hud_init(unsigned int width, unsigned int height, unsigned int border_width,
+              color_t border, color_t background, color_t text);
+
+/*
+ * `hud_set_points`
+ *
+ * Update the points counter. Does no drawing if the value is unchanged.
+ *
+ * @param points  the new number of points, may be negative
+ */
+void hud_set_points(int points);
+
+/*
+ * `hud_set_high_score`
+ *
+ * Update the high score counter. Does no drawing if the value is unchanged.
+ *
+ * @param high_score  the new high score, may be negative
+ */
+void hud_set_high_score(int high_score);
+
+/*
+ * `hud_draw`
+ *
+ * Copy the banner to the upper left corner of the current gl target.
+ */
+void hud_draw(void);
+
+#endif
@@ -10,6 +10,8 @@
 #include "gpio.h"
 #include "i2c.h"
 #include "timer.h"
+#include "mailbox.h"
+#include "mmu.h"
 
 
 struct I2C { // I2C registers
@@ -41,6 +43,15 @@ struct I2C { // I2C registers
 
 #define FIFO_MAX_SIZE 16
 
+#define STATUS_FINISHED (STATUS_TRANSFER_DONE | STATUS_ERROR_PERIPHERAL_ACK | STATUS_TIMEOUT)
+
+#define MAX_DIVIDER     0xfffe // the controller uses even dividers only
+#define DEFAULT_DELAY   0x30   // core clocks between an SCL edge and SDA, at reset
+
+// longest wait on the controller, in microseconds. a full FIFO takes about
+// 40 ms at the slowest bus speed; a bus held low by a peripheral never ends
+#define WAIT_TIMEOUT_US 100000
+
 /*
  * There are three I2C controllers on the Raspberry Pi, with the following
  * bus addresses:
@@ -57,20 +68,109 @@ struct I2C { // I2C registers
 
 static volatile struct I2C *i2c = (struct I2C *) BSC_BASE;
 
-// #define SHORT_DELAY 50
-#define NORM_DELAY 500
+/* waits until any of the status bits in mask are set, or all are clear if
+   set is false. returns false if that has not happened within the timeout */
+static bool wait_status(int mask, bool set) {
+    unsigned int start = timer_get_ticks();
+    while (((i2c->status & mask) != 0) != set) {
+        if (timer_get_ticks() - start > WAIT_TIMEOUT_US)
+            return false;
+    }
+    return true;
+}
+
+/*
+ * The core clock is asked for with a GET_CLOCK_RATE message on the
+ * property channel. The GPU reads and writes the message in memory, so
+ * it is flushed from the data cache around the request, as in fb.c. The
+ * reply on this channel is the address of the message, not the 0 that
+ * mailbox_request expects, so the success code in the message itself is
+ * checked. If the request fails the clock is assumed to be at its
+ * default rate.
+ */
+#define TAG_GET_CLOCK_RATE  0x00030002
+#define CLOCK_CORE          4
+#define MAILBOX_SUCCESS     0x80000000
+#define DEFAULT_CORE_CLOCK  250000000
+
+typedef struct {
+    unsigned int size;        // bytes in the message
+    unsigned int code;        // 0 to request, MAILBOX_SUCCESS in the reply
+    unsigned int tag;
+    unsigned int value_size;  // bytes of room for the value
+    unsigned int value_code;  // 0 to request
+    unsigned int clock_id;
+    unsigned int rate;        // Hz, in the reply
+    unsigned int end;         // 0
+} __attribute__ ((aligned(32))) clock_message_t; // the mailbox needs 16, a cache line is 32
+
+static unsigned int core_clock;
+static unsigned int bus_speed;
+
+static unsigned int get_core_clock(void) {
+    if (core_clock)
+        return core_clock;
+    static clock_message_t msg;
+    msg = (clock_message_t){sizeof(msg), 0, TAG_GET_CLOCK_RATE, 8, 0, CLOCK_CORE, 0, 0};
+    mmu_flush_range(&msg, sizeof(msg));
+    mailbox_write(MAILBOX_TAGS_ARM_TO_VC, (unsigned int)&msg);
+    mailbox_read(MAILBOX_TAGS_ARM_TO_VC); // the reply is the message itself
+    mmu_invalidate_range(&msg, sizeof(msg));
+    if (msg.code == MAILBOX_SUCCESS && msg.rate)
+        core_clock = msg.rate;
+    else
+        core_clock = DEFAULT_CORE_CLOCK;
+    return core_clock;
+}
 
 void i2c_init(void) {
     gpio_set_function(SDA, GPIO_FUNC_ALT0);
     gpio_set_function(SCL, GPIO_FUNC_ALT0);
     i2c->control = CONTROL_ENABLE;
+    i2c_set_speed(I2C_STANDARD_MODE);
+}
+
+unsigned int i2c_set_speed(unsigned int hz) {
+    unsigned int clock = get_core_clock();
+    if (hz == 0)
+        hz = 1;
+    // the smallest even divider that does not go over hz
+    unsigned int divider = (clock + hz - 1) / hz;
+    divider = (divider + 1) & ~1;
+    if (divider < 2)
+        divider = 2;
+    if (divider > MAX_DIVIDER)
+        divider = MAX_DIVIDER;
+
+    // the delays after each clock edge must end well within half a clock period
+    unsigned int delay = divider / 4;
+    if (delay > DEFAULT_DELAY)
+        delay = DEFAULT_DELAY;
+    if (delay < 1)
+        delay = 1;
+
+    // change the timing only between transfers, keeping it if one is stuck
+    if (!wait_status(STATUS_TRANSFER_ACTIVE, false))
+        return bus_speed;
+    i2c->clock_divider = divider;
+    i2c->data_delay = (delay << 16) | delay; // falling edge, rising edge
+    bus_speed = clock / divider;
+    return bus_speed;
+}
+
+unsigned int i2c_get_speed(void) {
+    return bus_speed;
+}
+
+void i2c_set_clock_stretch_timeout(unsigned int cycles) {
+    i2c->clock_stretch_timeout = (cycles > 0xffff) ? 0xffff : cycles;
 }
 
 void i2c_read(unsigned peripheral_address, char *data, int data_length) {
     // clear out the FIFO
     i2c->control |= CONTROL_CLEAR_FIFO;
-    while (!(i2c->status & STATUS_FIFO_EMPTY))
-        ;
+    if (!wait_status(STATUS_FIFO_EMPTY, true))
+        return;
     // clear previous transfer's flags
     i2c->status |= STATUS_TRANSFER_DONE |
                    STATUS_ERROR_PERIPHERAL_ACK |
@@ -84,13 +184,20 @@ void i2c_read(unsigned peripheral_address, char *data, int data_length) {
     // begin read
     i2c->control |= CONTROL_READ | CONTROL_START;
 
-    timer_delay_us(NORM_DELAY);
-    // keep reading until transfer is complete
-    while ((i2c->status & STATUS_FIFO_CAN_READ) &&
-            (!(i2c->status & STATUS_TRANSFER_DONE) ||
-             (data_index < data_length))) {
-        timer_delay_us(40);
-        data[data_index++] = i2c->data_fifo;
+    // take each byte as it arrives, at whatever speed the bus runs, until
+    // all are in, the transfer has ended without them or none has come
+    // within the timeout
+    unsigned int last_byte = timer_get_ticks();
+    while (data_index < data_length) {
+        int status = i2c->status;
+        if (status & STATUS_FIFO_CAN_READ) {
+            data[data_index++] = i2c->data_fifo;
+            last_byte = timer_get_ticks();
+        } else if (status & STATUS_FINISHED) {
+            break;
+        } else if (timer_get_ticks() - last_byte > WAIT_TIMEOUT_US) {
+            return;
+        }
     }
 #if 0
     // inform end user of potential responses
@@ -109,8 +216,8 @@ void i2c_read(unsigned peripheral_address, char *data, int data_length) {
 void i2c_write(unsigned peripheral_address, char *data, int data_length) {
     // clear out the FIFO
     i2c->control |= CONTROL_CLEAR_FIFO;
-    while (!(i2c->status & STATUS_FIFO_EMPTY))
-        ;
+    if (!wait_status(STATUS_FIFO_EMPTY, true))
+        return;
     // clear previous transfer's flags
     i2c->status |= STATUS_TRANSFER_DONE |
                    STATUS_ERROR_PERIPHERAL_ACK |
@@ -140,7 +247,11 @@ void i2c_write(unsigned peripheral_address, char *data, int data_length) {
 
     // wait until the FIFO's contents are emptied by the peripheral
     //timer_delay_us(250);
-    while (!(i2c->status & STATUS_FIFO_EMPTY)){};
+    if (!wait_status(STATUS_FIFO_EMPTY, true))
+        return;
+    // and the last byte is out, so the next transfer starts on an idle bus
+    if (!wait_status(STATUS_FINISHED, true))
+        return;
 
 #if 0
     // inform end user of potential responses
@@ -0,0 +1,70 @@
+#ifndef I2C_H
+#define I2C_H
+
+/*
+ * I2C on the BSC1 controller of the Raspberry Pi (SDA on GPIO 2, SCL on
+ * GPIO 3). The transfer functions are those of the libpi module; this
+ * header takes its place to add control of the bus timing.
+ *
+ * The bus clock is the core clock divided down. After `i2c_init` the
+ * bus runs at the 100kHz of standard mode; `i2c_set_speed` picks another
+ * rate, such as the 400kHz of fast mode that the LSM6DS33 supports.
+ */
+
+#define I2C_STANDARD_MODE 100000
+#define I2C_FAST_MODE     400000
+
+/*
+ * `i2c_init`
+ *
+ * Set up the pins and the controller, with the bus at standard mode.
+ */
+void i2c_init(void);
+
+/*
+ * `i2c_read`
+ *
+ * Read data_length bytes from a peripheral into data. Returns early,
+ * with the rest of data untouched, if the peripheral does not answer
+ * or the bus is stuck for 100ms.
+ */
+void i2c_read(unsigned peripheral_address, char *data, int data_length);
+
+/*
+ * `i2c_write`
+ *
+ * Write data_length bytes from data to a peripheral. Gives up if the
+ * bus is stuck for 100ms.
+ */
+void i2c_write(unsigned peripheral_address, char *data, int data_length);
+
+/*
+ * `i2c_set_speed`
+ *
+ * Set the bus clock as close to hz as the divider allows without going
+ * over. The core clock is asked of the GPU through the mailbox. The data
+ * delays are kept within what the new clock period allows.
+ *
+ * @param hz  the bus clock in Hz, such as I2C_FAST_MODE
+ * @return    the bus clock it was set to
+ */
+unsigned int i2c_set_speed(unsigned int hz);
+
+/*
+ * `i2c_get_speed`
+ *
+ * @return  the bus clock in Hz
+ */
+unsigned int i2c_get_speed(void);
+
+/*
+ * `i2c_set_clock_stretch_timeout`
+ *
+ * Set how long a peripheral may hold the clock low before the transfer
+ * fails with a timeout.
+ *
+ * @param cycles  the limit in bus clock cycles, up to 65535; 0 waits forever
+ */
+void i2c_set_clock_stretch_timeout(unsigned int cycles);
+
+#endif
@@ -0,0 +1,54 @@
+/*
+ * I2C benchmark. Reads the LSM6DS33 at each bus speed and reports over
+ * the uart how many transactions go through per second and how long a
+ * full accelerometer reading takes. Build and run with `make i2c_bench`.
+ *
+ * A register read is two transactions, writing the register address
+ * and reading the value back. The WHO_AM_I register is read, so every
+ * reply can be checked.
+ */
+
+#include "uart.h"
+#include "timer.h"
+#include "printf.h"
+#include "i2c.h"
+#include "LSM6DS33.h"
+
+#define BENCH_READS 1000
+#define WHO_AM_I_VALUE 0x69
+
+static const unsigned int speeds[] = {I2C_STANDARD_MODE, 200000, I2C_FAST_MODE};
+
+/* times register reads and accelerometer readings at a bus speed of hz */
+static void run(unsigned int hz)
+{
+	unsigned int actual = i2c_set_speed(hz);
+
+	int errors = 0;
+	unsigned int start = timer_get_ticks();
+	for (int i = 0; i < BENCH_READS; i++)
+		if (lsm6ds33_read_reg(WHO_AM_I) != WHO_AM_I_VALUE)
+			errors++;
+	unsigned int elapsed = timer_get_ticks() - start;
+	unsigned int per_second = (2 * BENCH_READS * 1000000ULL) / elapsed;
+
+	short x, y, z;
+	start = timer_get_ticks();
+	for (int i = 0; i < BENCH_READS; i++)
+		lsm6ds33_read_accelerometer(&x, &y, &z);
+	unsigned int reading = (timer_get_ticks() - start) / BENCH_READS;
+
+	printf("%d Hz (asked %d): %d transactions/s, %d us/register, %d us/reading, %d errors\n",
+	       actual, hz, per_second, elapsed / BENCH_READS, reading, errors);
+}
+
+void main(void)
+{
+	uart_init();
+	timer_init();
+	i2c_init();
+	lsm6ds33_init();
+	for (int i = 0; i < sizeof(speeds) / sizeof(speeds[0]); i++)
+		run(speeds[i]);
+	uart_putchar(EOT);
+}
@@ -0,0 +1,178 @@
+#include "mmu.h"
+#include <stdbool.h>
+
+// the MMU is set up on the Pi itself; other builds have nothing to set up
+#if defined(__arm__) && !defined(__linux__)
+
+// section descriptor fields (ARMv6 format, with SCTLR.XP set)
+#define SECTION          0x00002
+#define BUFFERABLE       0x00004
+#define CACHEABLE        0x00008
+#define EXECUTE_NEVER    0x00010
+#define FULL_ACCESS      0x00c00
+#define TEX(n)           ((n) << 12)
+
+// memory types, (TEX, C, B) in the ARM1176 manual
+#define NORMAL_CACHED    (SECTION | FULL_ACCESS | TEX(1) | CACHEABLE | BUFFERABLE) // write-back, write-allocate
+#define NORMAL_UNCACHED  (SECTION | FULL_ACCESS | TEX(1))
+#define DEVICE           (SECTION | FULL_ACCESS | BUFFERABLE | EXECUTE_NEVER)
+#define STRONGLY_ORDERED (SECTION | FULL_ACCESS | EXECUTE_NEVER)
+
+// control register bits
+#define SCTLR_MMU                0x00000001
+#define SCTLR_DCACHE             0x00000004
+#define SCTLR_BRANCH_PREDICTION  0x00000800
+#define SCTLR_ICACHE             0x00001000
+#define SCTLR_XP                 0x00800000 // ARMv6 page table format
+
+#define RAM_END          0x20000000
+#define PERIPHERAL_END   0x21000000
+
+#define SECTION_SIZE     0x100000
+#define LINE_SIZE        32
+#define DCACHE_SIZE      (16 * 1024)
+
+// one word per megabyte of the address space
+static unsigned int page_table[4096] __attribute__((aligned(16384)));
+static bool enabled;
+static unsigned int fb_start, fb_end;
+
+/* the memory type of the section holding address */
+static unsigned int section_type(unsigned int address)
+{
+	if (address >= (fb_start & ~(SECTION_SIZE - 1)) && address < fb_end)
+		return NORMAL_UNCACHED;
+	if (address < RAM_END)
+		return NORMAL_CACHED;
+	if (address < PERIPHERAL_END)
+		return DEVICE;
+	return STRONGLY_ORDERED;
+}
+
+#define CP15_WRITE(crn, op1, crm, op2, value) \
+	__asm__ volatile("mcr p15, " #op1 ", %0, " #crn ", " #crm ", " #op2 : : "r" (value) : "memory")
+
+static inline void sync_memory(void)
+{
+	CP15_WRITE(c7, 0, c10, 4, 0); // data synchronization barrier
+}
+
+static inline void invalidate_tlb(void)
+{
+	CP15_WRITE(c8, 0, c7, 0, 0);
+	CP15_WRITE(c7, 0, c5, 4, 0);  // flush the prefetch buffer
+}
+
+void mmu_init(void)
+{
+	for (unsigned int i = 0; i < 4096; i++)
+		page_table[i] = (i << 20) | section_type(i << 20);
+
+	CP15_WRITE(c7, 0, c7, 0, 0);  // invalidate both caches
+	invalidate_tlb();
+	sync_memory();
+	CP15_WRITE(c2, 0, c0, 0, (unsigned int)page_table); // translation table base 0
+	CP15_WRITE(c2, 0, c0, 2, 0);  // use table base 0 for all addresses
+	CP15_WRITE(c3, 0, c0, 0, 1);  // domain 0 checks the access bits
+
+	unsigned int control;
+	__asm__ volatile("mrc p15, 0, %0, c1, c0, 0" : "=r" (control));
+	control |= SCTLR_MMU | SCTLR_DCACHE | SCTLR_BRANCH_PREDICTION | SCTLR_ICACHE | SCTLR_XP;
+	CP15_WRITE(c1, 0, c0, 0, control);
+	CP15_WRITE(c7, 0, c5, 4, 0);
+	enabled = true;
+}
+
+void mmu_set_framebuffer(const void *start, unsigned int bytes)
+{
+	unsigned int old_start = fb_start, old_end = fb_end;
+	fb_start = (unsigned int)start;
+	fb_end = fb_start + bytes;
+	if (!enabled)
+		return;
+
+	// data in the cache for the new framebuffer must not be written over it
+	mmu_flush_range((void *)start, bytes);
+	for (unsigned int a = old_start & ~(SECTION_SIZE - 1); a < old_end; a += SECTION_SIZE)
+		page_table[a >> 20] = a | section_type(a);
+	for (unsigned int a = fb_start & ~(SECTION_SIZE - 1); a < fb_end; a += SECTION_SIZE)
+		page_table[a >> 20] = a | section_type(a);
+	mmu_clean_range(page_table, sizeof(page_table));
+	invalidate_tlb();
+}
+
+enum { CLEAN, INVALIDATE, FLUSH };
+
+/* applies a data cache line operation to the cached part of a range. a
+   range at least the size of the cache takes one operation on the whole
+   cache instead */
+static void range_op(unsigned int start, unsigned int bytes, int op)
+{
+	if (!enabled || bytes == 0) {
+		sync_memory();
+		return;
+	}
+	if (bytes >= DCACHE_SIZE && (page_table[start >> 20] & CACHEABLE)) {
+		if (op == CLEAN)
+			CP15_WRITE(c7, 0, c10, 0, 0);
+		else
+			CP15_WRITE(c7, 0, c14, 0, 0); // dirty lines are kept, not dropped
+		sync_memory();
+		return;
+	}
+
+	unsigned int end = start + bytes;
+	for (unsigned int line = start & ~(LINE_SIZE - 1); line < end; line += LINE_SIZE) {
+		if (!(page_table[line >> 20] & CACHEABLE)) {
+			line = (line | (SECTION_SIZE - 1)) + 1 - LINE_SIZE; // nothing cached here
+			continue;
+		}
+		bool partial = line < start || line + LINE_SIZE > end;
+		if (op == CLEAN)
+			CP15_WRITE(c7, 0, c10, 1, line);
+		else if (op == INVALIDATE && !partial)
+			CP15_WRITE(c7, 0, c6, 1, line);
+		else
+			CP15_WRITE(c7, 0, c14, 1, line);
+	}
+	sync_memory();
+}
+
+void mmu_clean_range(const void *start, unsigned int bytes)
+{
+	range_op((unsigned int)start, bytes, CLEAN);
+}
+
+void mmu_invalidate_range(void *start, unsigned int bytes)
+{
+	range_op((unsigned int)start, bytes, INVALIDATE);
+}
+
+void mmu_flush_range(void *start, unsigned int bytes)
+{
+	range_op((unsigned int)start, bytes, FLUSH);
+}
+
+#else
+
+void mmu_init(void)
+{
+}
+
+void mmu_set_framebuffer(const void *start, unsigned int bytes)
+{
+}
+
+void mmu_clean_range(const void *start, unsigned int bytes)
+{
+}
+
+void mmu_invalidate_range(void *start, unsigned int bytes)
+{
+}
+
+void mmu_flush_range(void *start, unsigned int bytes)
+{
+}
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef MMU_H
+#define MMU_H
+
+/*
+ * MMU and cache setup for the ARM1176, and the cache maintenance that
+ * memory shared with the GPU or the DMA controller needs once the data
+ * cache is on.
+ *
+ * The page table maps all of memory flat, one megabyte section at a
+ * time:
+ *  - RAM below 0x20000000 is normal memory, write-back cached, for code,
+ *    data and heap.
+ *  - The peripherals at 0x20000000 (GPIO, timer, BSC1 at 0x20804000 and
+ *    the rest) are device memory, never cached or executed.
+ *  - The framebuffer is normal memory that is not cached, so stores to it
+ *    merge in the write buffer instead of going out one at a time.
+ *  - Everything else is strongly ordered.
+ *
+ * A device reads memory as it is in RAM, not as it is in the data
+ * cache, so memory the CPU has written must be cleaned before a device
+ * reads it, and invalidated before the CPU reads what a device wrote.
+ * The range functions below do this, skipping memory that is not cached.
+ * They are cheap no-ops before `mmu_init`.
+ */
+
+/*
+ * `mmu_init`
+ *
+ * Build the page table and turn on the MMU, the instruction and data
+ * caches and branch prediction. Code that writes instructions as data,
+ * such as `interrupts_init` copying the vector table, must run first.
+ */
+void mmu_init(void);
+
+/*
+ * `mmu_set_framebuffer`
+ *
+ * Map the bytes at start as framebuffer memory, in place of an earlier
+ * framebuffer. May be called before `mmu_init`, which then maps it.
+ *
+ * @param start  the first byte of the framebuffer, as returned by the GPU
+ * @param bytes  the size of the framebuffer, all buffers included
+ */
+void mmu_set_framebuffer(const void *start, unsigned int bytes);
+
+/*
+ * `mmu_clean_range`
+ *
+ * Write the cached bytes of start up to start + bytes back to RAM, for a
+ * device to read.
+ */
+void mmu_clean_range(const void *start, unsigned int bytes);
+
+/*
+ * `mmu_invalidate_range`
+ *
+ * Drop the cached bytes of start up to start + bytes, so the CPU reads
+ * what a device wrote. Cache lines that extend past either end are
+ * written back first, so neighboring data is kept.
+ */
+void mmu_invalidate_range(void *start, unsigned int bytes);
+
+/*
+ * `mmu_flush_range`
+ *
+ * Write back and drop the cached bytes of start up to start + bytes,
+ * before a device writes them.
+ */
+void mmu_flush_range(void *start, unsigned int bytes);
+
+#endif
@@ -1,15 +1,16 @@
 #ifndef _MY_MODULE_H
+#define _MY_MODULE_H
+
+#include "gl.h"
+#include "anim.h"
+#include "fixed.h"
 
 #define LEFT -1
 #define RIGHT 1
 #define SCALE 3
 
-typedef struct {
-	unsigned int width;
-	unsigned int height;
-	unsigned int bytes_per_pixel; //always 4
-	unsigned char pixel_data[];
-} img_t;
+// sprites are generated into sprites.h by tools/spritegen.py
+typedef gl_sprite_t img_t;
 
 typedef struct {
 	int x;
@@ -18,16 +19,19 @@ typedef struct {
 	int height;
 } collider_t;
 
+// positions and velocities are in fixed point, so objects can move by
+// fractions of a pixel; they are rounded to pixels to draw and collide
 typedef struct {
-    int velocity_x;
-    int velocity_y;
-	int x;
-    int y;
+    fix_t velocity_x;
+    fix_t velocity_y;
+	fix_t x;
+    fix_t y;
 	int status;
 	int type;
 	int anim_frame;
     collider_t *collider;
 	const img_t *img;
+	anim_player_t *anim; // NULL if the object is not animated
 } object_t;
 
 #endif
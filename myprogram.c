@@ -1,16 +1,22 @@
 #include "uart.h"
 #include "mymodule.h"
 #include "gl.h"
+#include "hud.h"
+#include "gl_cmd.h"
+#include "mmu.h"
 #include "timer.h"
 #include "accel.h"
+#include "control.h"
 #include "printf.h"
 #include "malloc.h"
-#include "rand.h"
+#include "assert.h"
+#include "rng.h"
 #include "gpio.h"
 #include "gpio_extra.h"
 #include "gpio_interrupts.h"
 #include "interrupts.h"
 #include "ringbuffer.h"
+#include "sprites.h"
 
 #define LASER_SPEED 20
 #define FRAMES 5
@@ -19,6 +25,14 @@
 #define BANNER_COLOR 0xffaa8eed
 #define TEXT_COLOR 0xffaa8eed
 #define BACKGROUND_COLOR 0xff121015//0x0e200e
+#define MAX_BANK_TILT 50 // roll in degrees at which the rocket is drawn fully banked, where it reaches top speed
+#define MAX_ROCKET_SPEED FIX_CONST(30)
+#define ASTEROID_SPEEDUP FIX_CONST(0.25) // pixels per frame added each time the spawn rate goes up
+#define MAX_ASTEROID_SPEED FIX_CONST(20)
+#define TIMED_FRAMES 256 // frames averaged for each frame time logged
+
+// display list layers, drawn bottom to top
+enum { LAYER_ROCKET, LAYER_ASTEROIDS, LAYER_BUGS, LAYER_LASERS, LAYER_GLITCH, LAYER_TEXT };
 
 static const int BUTTON = GPIO_PIN23;
 static int shootCount = 0;
@@ -29,48 +43,10 @@ static int high_score = 0;
 static unsigned int game_over = 0;
 static unsigned int start_screen = 1;
 static unsigned int num_asteroids = 2;
-static unsigned int ultra = 30;
-static unsigned int fast = 25;
-static unsigned int medium = 20;
-static unsigned int slow = 15;
 #define INITIAL_SPAWNRATE 30;
-static short a = 0;
-static const img_t rocket_img;
-static const img_t rocket_e1;
-static const img_t rocket_e2;
-static const img_t rocket_e3;
-static const img_t rocket_e4;
-static const img_t *rocket_anim[] = {&rocket_img, &rocket_e1, &rocket_e2, &rocket_e3, &rocket_e4};
-static const img_t asteroid1_img;
-static const img_t asteroid1_e1;
-static const img_t asteroid1_e2;
-static const img_t asteroid1_e3;
-static const img_t asteroid1_e4;
-static const img_t *asteroid1_anim[] = {&asteroid1_img, &asteroid1_e1, &asteroid1_e2, &asteroid1_e3, &asteroid1_e4};
-static const img_t asteroid2_img;
-static const img_t asteroid2_e1;
-static const img_t asteroid2_e2;
-static const img_t asteroid2_e3;
-static const img_t asteroid2_e4;
-static const img_t *asteroid2_anim[] = {&asteroid2_img, &asteroid2_e1, &asteroid2_e2, &asteroid2_e3, &asteroid2_e4};
-static const img_t asteroid3_img;
-static const img_t asteroid3_e1;
-static const img_t asteroid3_e2;
-static const img_t asteroid3_e3;
-static const img_t asteroid3_e4;
-static const img_t *asteroid3_anim[] = {&asteroid3_img, &asteroid3_e1, &asteroid3_e2, &asteroid3_e3, &asteroid3_e4};
-static const img_t **asteroid_anims[] = {asteroid1_anim, asteroid2_anim, asteroid3_anim};
-static const img_t bug_walk1;
-static const img_t bug_walk2;
-static const img_t bug_walk3;
-static const img_t bug_walk4;
-static const img_t *bug_walk[] = {&bug_walk1, &bug_walk2, &bug_walk3, &bug_walk4};
-static const img_t bug_e1;
-static const img_t bug_e2;
-static const img_t bug_e3;
-static const img_t bug_e4;
-static const img_t *bug_explode[] = {&bug_walk1, &bug_e1, &bug_e2, &bug_e3, &bug_e4}; 
-static const img_t laser_img;
+
+// animations are generated into sprites.h from art/anims.txt
+static const anim_t *asteroid_explode[] = {&asteroid1_explode, &asteroid2_explode, &asteroid3_explode};
 
 // --- color palette ---
 // light green: 0xff42c342
@@ -84,7 +60,8 @@ void init()
 {
 	accel_init();
 	uart_init();
-	gl_init(640, 480, GL_DOUBLEBUFFER);
+	gl_init(640, 480, GL_DOUBLEBUFFER | GL_DMA);
+	control_init(MAX_ROCKET_SPEED, fix_from_int(MAX_BANK_TILT));
 }
 
 /* handler function does the action we want to interrupt with */
@@ -111,10 +88,17 @@ void interrupts()
 }
 
 
+/* starts a new game's random numbers from the time, logging the seed so the game can be replayed */
+void seed_random(void)
+{
+	rng_seed(timer_get_ticks());
+	printf("seed %x\n", rng_get_seed());
+}
+
 /* gets random number between 0 and 99 (we will call this in future random functions) */
 unsigned int get_random(void)
 {
-	return rand() % 100;
+	return rng_below(100);
 }
 
 /* gets an astroid spawn location; one of 10 locations */ 
@@ -123,36 +107,55 @@ unsigned int get_asteroid_spawn_loc(unsigned int left_border, unsigned int right
 	right_border += asteroid_width * SCALE;
 	left_border += asteroid_width * SCALE;
 	unsigned int interval = (right_border - left_border) / 10;
-	return interval * (get_random() % 10 + 1);
+	return interval * (rng_below(10) + 1);
 }
 
 unsigned int get_asteroid_type(unsigned int num_asteroids){
-	return get_random() % num_asteroids;
+	return rng_below(num_asteroids);
 }
 
-/* returns the velocity of the rocket according to the accelerometer reading */
-int get_rocket_velocity(int accel_val)
+/* returns the velocity of the rocket according to the roll of the controller */
+fix_t get_rocket_velocity(fix_t roll)
 {
-	int velocity = 0;
-	if (a < -800)
-		velocity = ultra * LEFT; // step tilt of accelerometer gives faster rocket velocity
-	if (-600 >= a && a > -800)
-		velocity = fast * LEFT;
-	if (-300 >= a && a > -600)
-		velocity = medium * LEFT;
-	if (-125 >= a && a > -300) // less step tilt of accelerometer gives slower rocket velocity
-		velocity = slow * LEFT;
-	if (125 >= a && a > -125)
-		velocity = 0; // range in which accelerometer will not move the rocket
-	if (125 < a && a <= 300)
-		velocity = slow * RIGHT; // same but going right instead of left (pos instead of neg)
-	if (300 < a && a <= 600)
-		velocity = medium * RIGHT;
-	if (600 < a && a <= 800)
-		velocity = fast * RIGHT;
-	if (a > 800)
-		velocity = ultra * RIGHT;
-	return velocity;
+	return control_update(roll);
+}
+
+/* index into rocket_bank of the turned rocket closest to the given tilt */
+int get_bank_frame(int tilt)
+{
+	int steps = ROCKET_BANK_COUNT / 2;
+	if (tilt > MAX_BANK_TILT)
+		tilt = MAX_BANK_TILT;
+	if (tilt < -MAX_BANK_TILT)
+		tilt = -MAX_BANK_TILT;
+	int half = (tilt < 0) ? -MAX_BANK_TILT / 2 : MAX_BANK_TILT / 2; // round to the nearest step
+	return steps + (tilt * steps + half) / MAX_BANK_TILT;
+}
+
+/* frees a spawned object along with its collider and animation player */
+void free_object(object_t *obj)
+{
+	anim_player_free(obj->anim);
+	free(obj->collider);
+	free(obj);
+}
+
+/* the collider of an object where it is now, from the collider box of its sprite */
+collider_t sprite_collider(const object_t *obj)
+{
+	return (collider_t){
+		fix_round(obj->x) + obj->img->collider_x * SCALE, fix_round(obj->y) + obj->img->collider_y * SCALE,
+		obj->img->collider_w * SCALE, obj->img->collider_h * SCALE};
+}
+
+/* moves an object by dx, dy, keeping its collider on the pixel the object is drawn at */
+void move_object(object_t *obj, fix_t dx, fix_t dy)
+{
+	int x = fix_round(obj->x), y = fix_round(obj->y);
+	obj->x += dx;
+	obj->y += dy;
+	obj->collider->x += fix_round(obj->x) - x;
+	obj->collider->y += fix_round(obj->y) - y;
 }
 
 /* find maximum of two ints */
@@ -185,13 +188,13 @@ bool overlap(unsigned int a, unsigned int b, unsigned int c, unsigned int d)
 	return false;
 }
 
-/* moves rocket using acceleromater value a */
-int move_rocket(object_t rocket, unsigned int left_border, unsigned int right_border)
+/* moves rocket using the roll of the controller */
+fix_t move_rocket(object_t rocket, unsigned int left_border, unsigned int right_border)
 {
 	// recalculate rocket position
-	a = accel_vals();
-	int velocity = get_rocket_velocity(a);
-	if ((rocket.x <= left_border && velocity < 0) || (rocket.x >= right_border && velocity > 0))
+	fix_t velocity = get_rocket_velocity(accel_roll(NULL));
+	int x = fix_round(rocket.x);
+	if ((x <= (int)left_border && velocity < 0) || (x >= (int)right_border && velocity > 0))
 		velocity = 0; // keep rocket from moving off the edge of the screen
 	return velocity;
 }
@@ -228,6 +231,11 @@ void main(void)
 {
 	init();
 	interrupts(); // init interrupts
+	// caches on, once the vector table is in place. holding the button at
+	// power-up leaves them off, to compare the logged frame times
+	bool caches = gpio_read(BUTTON) == 1;
+	if (caches)
+		mmu_init();
 	rb_t *rb = rb_new();
 	gpio_enable_event_detection(BUTTON, GPIO_DETECT_FALLING_EDGE);
 	gpio_interrupts_init();										
@@ -243,12 +251,12 @@ void main(void)
 
 	// Set rocket at x = 300 and y = 400
 	object_t rocket = {0, 0,			   // init x and y velocity
-					   300, 400, true, 0, 0,  // x and y position, info on status and type
-					   NULL, &rocket_img}; // collider info, image
-	// set rocket collider to be a rectangle slightly smaller than rocket
-	collider_t rocket_collider = { 
-		rocket.x + 3 * SCALE, rocket.y + 3 * SCALE,
-		(rocket.img->width - 6) * SCALE, (rocket.img->height - 6) * SCALE};
+					   fix_from_int(300), fix_from_int(400), true, 0, 0,  // x and y position, info on status and type
+					   NULL, &rocket_img, anim_player_new(&rocket_explode)}; // collider info, image, animation
+	assert(rocket.anim);
+	rocket.img = anim_sprite(rocket.anim);
+	// the rocket collider is a rectangle slightly smaller than the rocket, see art/frames.txt
+	collider_t rocket_collider = sprite_collider(&rocket);
 	rocket.collider = &rocket_collider;
 
 	// spawn asteroid at one of 10 random x locations 
@@ -260,7 +268,7 @@ void main(void)
 	int asteroid_spawnrate = INITIAL_SPAWNRATE;
 	int cur_asteroid_spawn = 0;
 	int asteroids_since_change = 0;
-	int asteroid_speed = 10;
+	fix_t asteroid_speed = fix_from_int(10);
 
 	// initialize lasers
 	object_t *lasers[MAX_LASERS];
@@ -271,61 +279,73 @@ void main(void)
 	unsigned int cur_bugs = 0;
 	int glitch = 0;
 
+	// the start screen never changes, so compose it once off-screen and copy it each frame
+	gl_surface_t *title = gl_surface_new(gl_get_width(), gl_get_height());
+	gl_set_target(title);
+	gl_clear(BACKGROUND_COLOR);
+	gl_draw_rect(10, 15, 1 * SCALE, 1 * SCALE, GL_WHITE);
+	gl_draw_rect(78, 42, 1 * SCALE, 1 * SCALE, GL_WHITE);
+	gl_draw_rect(6, 400, 1 * SCALE, 1 * SCALE, GL_WHITE);
+	gl_draw_rect(210, 150, 1 * SCALE, 1 * SCALE, GL_WHITE);
+	gl_draw_rect(194, 50, 1 * SCALE, 1 * SCALE, GL_WHITE);
+	gl_draw_rect(179, 567, 1 * SCALE, 1 * SCALE, GL_WHITE);
+	gl_draw_rect(7, 282, 1 * SCALE, 1 * SCALE, GL_WHITE);
+	gl_draw_rect(263, 32, 1 * SCALE, 1 * SCALE, GL_WHITE);
+	gl_draw_rect(347, 330, 1 * SCALE, 1 * SCALE, GL_WHITE);
+	gl_draw_rect(198, 293, 1 * SCALE, 1 * SCALE, GL_WHITE);
+	gl_draw_rect(420, 420, 1 * SCALE, 1 * SCALE, GL_WHITE);
+	gl_draw_rect(617, 189, 1 * SCALE, 1 * SCALE, GL_WHITE);
+	gl_draw_rect(154, 345, 1 * SCALE, 1 * SCALE, GL_WHITE);
+	gl_draw_rect(506, 18, 1 * SCALE, 1 * SCALE, GL_WHITE);
+	gl_draw_rect(678, 651, 1 * SCALE, 1 * SCALE, GL_WHITE);
+	gl_draw_rect(431, 451, 1 * SCALE, 1 * SCALE, GL_WHITE);
+	gl_draw_rect(263, 87, 1 * SCALE, 1 * SCALE, GL_WHITE);
+	gl_draw_rect(626, 611, 1 * SCALE, 1 * SCALE, GL_WHITE);
+	gl_draw_rect(620, 742, 1 * SCALE, 1 * SCALE, GL_WHITE);
+	gl_draw_rect(612, 178, 1 * SCALE, 1 * SCALE, GL_WHITE);
+	gl_draw_rect(671, 34, 1 * SCALE, 1 * SCALE, GL_WHITE);
+	gl_draw_rect(361, 741, 1 * SCALE, 1 * SCALE, GL_WHITE);
+	gl_draw_rect(512, 398, 1 * SCALE, 1 * SCALE, GL_WHITE);
+	gl_draw_rect(19, 324, 1 * SCALE, 1 * SCALE, GL_WHITE);
+	gl_draw_rect(580, 451, 1 * SCALE, 1 * SCALE, GL_WHITE);
+	gl_draw_string(220, 210, "ROCKETBERRY PI", GL_WHITE);
+	gl_draw_string(180, 260, "Press button to play", GL_WHITE);
+	gl_set_target(NULL);
+
 	while(start_screen == 1){
-		gl_clear(BACKGROUND_COLOR);
-		gl_draw_rect(10, 15, 1 * SCALE, 1 * SCALE, GL_WHITE);
-		gl_draw_rect(78, 42, 1 * SCALE, 1 * SCALE, GL_WHITE);
-		gl_draw_rect(6, 400, 1 * SCALE, 1 * SCALE, GL_WHITE);
-		gl_draw_rect(210, 150, 1 * SCALE, 1 * SCALE, GL_WHITE);
-		gl_draw_rect(194, 50, 1 * SCALE, 1 * SCALE, GL_WHITE);
-		gl_draw_rect(179, 567, 1 * SCALE, 1 * SCALE, GL_WHITE);
-		gl_draw_rect(7, 282, 1 * SCALE, 1 * SCALE, GL_WHITE);
-		gl_draw_rect(263, 32, 1 * SCALE, 1 * SCALE, GL_WHITE);
-		gl_draw_rect(347, 330, 1 * SCALE, 1 * SCALE, GL_WHITE);
-		gl_draw_rect(198, 293, 1 * SCALE, 1 * SCALE, GL_WHITE);
-		gl_draw_rect(420, 420, 1 * SCALE, 1 * SCALE, GL_WHITE);
-		gl_draw_rect(617, 189, 1 * SCALE, 1 * SCALE, GL_WHITE);
-		gl_draw_rect(154, 345, 1 * SCALE, 1 * SCALE, GL_WHITE);
-		gl_draw_rect(506, 18, 1 * SCALE, 1 * SCALE, GL_WHITE);
-		gl_draw_rect(678, 651, 1 * SCALE, 1 * SCALE, GL_WHITE);
-		gl_draw_rect(431, 451, 1 * SCALE, 1 * SCALE, GL_WHITE);
-		gl_draw_rect(263, 87, 1 * SCALE, 1 * SCALE, GL_WHITE);
-		gl_draw_rect(626, 611, 1 * SCALE, 1 * SCALE, GL_WHITE);
-		gl_draw_rect(620, 742, 1 * SCALE, 1 * SCALE, GL_WHITE);
-		gl_draw_rect(612, 178, 1 * SCALE, 1 * SCALE, GL_WHITE);
-		gl_draw_rect(671, 34, 1 * SCALE, 1 * SCALE, GL_WHITE);
-		gl_draw_rect(361, 741, 1 * SCALE, 1 * SCALE, GL_WHITE);
-		gl_draw_rect(512, 398, 1 * SCALE, 1 * SCALE, GL_WHITE);
-		gl_draw_rect(19, 324, 1 * SCALE, 1 * SCALE, GL_WHITE);
-		gl_draw_rect(580, 451, 1 * SCALE, 1 * SCALE, GL_WHITE);
-		gl_draw_string(220, 210, "ROCKETBERRY PI", GL_WHITE);
-		gl_draw_string(180, 260, "Press button to play", GL_WHITE);
+		gl_blit_surface(0, 0, title, 0, 0, title->width, title->height);
 		gl_swap_buffer();
 		if(rb_dequeue(rb, &shootCount)){
 			start_screen = 0;
 		}
 	}
+	seed_random(); // the moment the player presses the button varies from game to game
+	gl_surface_free(title);
+
+	// the banner is kept rendered off-screen and only its changed digits are redrawn
+	hud_init(gl_get_width(), BANNER_HEIGHT, SCALE, BANNER_COLOR, BACKGROUND_COLOR, GL_WHITE);
 
+	// each frame is drawn over a buffer cleared at the end of the frame before
+	gl_clear(BACKGROUND_COLOR);
+	unsigned int timed_frames = 0, timed_start = timer_get_ticks();
 	while (start_screen == 0)
 	{
 		// move rocket based on velocity from accelerometer 
-		int velocity = move_rocket(rocket, left_border, right_border);
-		rocket.velocity_x = velocity;
-		rocket.x += velocity;
-		rocket.collider->x += velocity;
+		rocket.velocity_x = move_rocket(rocket, left_border, right_border);
+		move_object(&rocket, rocket.velocity_x, 0);
 
 		// bug spawning
 		int bug_spawn = get_random();
 		if (bug_spawn == 69 && cur_bugs < 3) {
 			int random = get_asteroid_spawn_loc(left_border, right_border, asteroid1_img.width);
 			object_t *bug = malloc(sizeof(object_t));
-			*bug = (object_t) {0, 8,
-							   random, 0, true, 0, 0,
-							  NULL, &bug_walk1};
+			*bug = (object_t) {0, fix_from_int(8),
+							   fix_from_int(random), 0, true, 0, 0,
+							  NULL, &bug_walk1, anim_player_new(&bug_walk)};
+			assert(bug->anim);
+			bug->img = anim_sprite(bug->anim);
 			collider_t *bug_collider = malloc(sizeof(collider_t));
-			*bug_collider = (collider_t){
-				bug->x + 2 * SCALE, bug->y + 2 * SCALE,
-				(bug->img->width - 4) * SCALE, (bug->img->height - 4) * SCALE};
+			*bug_collider = sprite_collider(bug);
 			bug->collider = bug_collider;
 			bugs[cur_bugs] = bug;
 			cur_bugs++;
@@ -339,12 +359,12 @@ void main(void)
 			object_t *asteroid = malloc(sizeof(object_t));
 			
 			*asteroid = (object_t) {0, asteroid_speed, 
-									random, 0, true, type, 0,
-									NULL, asteroid_anims[type][0]};
+									fix_from_int(random), 0, true, type, 0,
+									NULL, asteroid_explode[type]->first, anim_player_new(asteroid_explode[type])};
+			assert(asteroid->anim);
+			asteroid->img = anim_sprite(asteroid->anim);
 			collider_t *asteroid_collider = malloc(sizeof(collider_t));
-			*asteroid_collider = (collider_t){
-				asteroid->x + 1 * SCALE, asteroid->y + 1 * SCALE,
-				(asteroid->img->width - 2) * SCALE, (asteroid->img->height - 2) * SCALE};
+			*asteroid_collider = sprite_collider(asteroid);
 			
 			asteroid->collider = asteroid_collider;
 			asteroids[num_asteroids] = asteroid;
@@ -353,24 +373,20 @@ void main(void)
 			if (asteroids_since_change > 3) {
 				if (asteroid_spawnrate > 4) {
 					asteroid_spawnrate--;
-					if (asteroid_spawnrate % 4 == 0)
-						if(asteroid_speed < 20){
-							asteroid_speed++;
-						}
+					asteroid_speed = fix_clamp(asteroid_speed + ASTEROID_SPEEDUP, 0, MAX_ASTEROID_SPEED);
 				}
 				asteroids_since_change = 0;
 			}
-			cur_asteroid_spawn = asteroid_spawnrate + (get_random() % 10 - 5);
+			cur_asteroid_spawn = asteroid_spawnrate + rng_range(-5, 4);
 		}
 		else
 			cur_asteroid_spawn--;
 
 		// recalculate asteroid positions
 		for (int i = 0; i < num_asteroids; i++) {
-			asteroids[i]->y += asteroids[i]->velocity_y;
-			asteroids[i]->collider->y += asteroids[i]->velocity_y;
-			if (asteroids[i]->y > max_y) {
-				free(asteroids[i]);
+			move_object(asteroids[i], 0, asteroids[i]->velocity_y);
+			if (asteroids[i]->y > fix_from_int(max_y)) {
+				free_object(asteroids[i]);
 				asteroids[i] = asteroids[num_asteroids - 1];
 				num_asteroids--;
 			}
@@ -378,20 +394,15 @@ void main(void)
 
 		// move bug
 		for (int i = 0; i < cur_bugs; i++) {
-			bugs[i]->y += bugs[i]->velocity_y;
-			bugs[i]->collider->y += bugs[i]->velocity_y;
-			bugs[i]->img = bug_walk[bugs[i]->anim_frame];
+			move_object(bugs[i], 0, bugs[i]->velocity_y);
 			if (bugs[i]->status == true) {
-				if (bugs[i]->anim_frame < 3)
-					bugs[i]->anim_frame++;
-				else
-					bugs[i]->anim_frame = 0;	
-				if (bugs[i]->y > max_y) {
+				anim_next(bugs[i]->anim); // the walk loops
+				if (bugs[i]->y > fix_from_int(max_y)) {
 					if (game_over == 0) {
 						points -= BUG_PENALTY;
 					}
 					glitch = 1;
-					free(bugs[i]);
+					free_object(bugs[i]);
 					bugs[i] = bugs[cur_bugs - 1];
 					cur_bugs--;
 				}
@@ -408,15 +419,13 @@ void main(void)
 				{
 					// initialize a new laser object starting at middle of rocket
 					object_t *laser = malloc(sizeof(object_t)); 
-					*laser = (object_t){0, LASER_SPEED,
-										rocket.x + (rocket.img->width / 2) * SCALE, rocket.y,
+					*laser = (object_t){0, fix_from_int(LASER_SPEED),
+										rocket.x + fix_from_int((rocket.img->width / 2) * SCALE), rocket.y,
 										true, 0, 0, NULL, &laser_img};
 
 					// initialize a new laser collider object
 					collider_t *laser_collider = malloc(sizeof(collider_t));
-					*laser_collider = (collider_t){
-						laser->x, laser->y,
-						(laser->img->width) * SCALE, (laser->img->height) * SCALE};
+					*laser_collider = sprite_collider(laser);
 					laser->collider = laser_collider;
 
 					// the current laser has the index corresponding to its laser number in the lasers array
@@ -431,32 +440,34 @@ void main(void)
 				// reset rocket
 				rocket.status = true;
 				rocket.anim_frame = 0;
-				rocket.img = rocket_anim[rocket.anim_frame];
-				rocket.x = 300;
-				rocket.y = 400;
-				rocket.collider->x = rocket.x;
-				rocket.collider->y = rocket.y;
+				anim_play(rocket.anim, &rocket_explode);
+				rocket.x = fix_from_int(300);
+				rocket.y = fix_from_int(400);
+				rocket.velocity_x = 0;
+				control_reset();
+				*rocket.collider = sprite_collider(&rocket);
 
 				// change high score
 				high_score = max(high_score, points);
 
 				// reset asteroid locations
 				for (int i = 0; i < num_asteroids; i++) {
-					free(asteroids[i]);
+					free_object(asteroids[i]);
 				}
 				num_asteroids = 0;
 				asteroid_spawnrate = INITIAL_SPAWNRATE;
-				asteroid_speed = 10;
+				asteroid_speed = fix_from_int(10);
 
 				// reset bugs
 				for (int i = 0; i < cur_bugs; i++) {
-					free(bugs[i]);
+					free_object(bugs[i]);
 				}
 			    cur_bugs = 0;
 
 				// reset points
 				points = 0;
 
+				seed_random();
 				game_over = 0;
 				continue;
 			}
@@ -465,13 +476,12 @@ void main(void)
 		for (int i = 0; i < cur_lasers; i++)
 		{
 			// move current laser along its path
-			lasers[i]->y -= lasers[i]->velocity_y;
-			lasers[i]->collider->y -= lasers[i]->velocity_y;
+			move_object(lasers[i], 0, -lasers[i]->velocity_y);
 
 			// if a laser hits the top of the screen, put last laser in place of ended laser
 			if (lasers[i]->y <= 0)
 			{
-				free(lasers[i]);
+				free_object(lasers[i]);
 				lasers[i] = lasers[cur_lasers - 1];
 				cur_lasers--;
 			}
@@ -481,12 +491,13 @@ void main(void)
 		if (detect_collision(num_asteroids, asteroids, rocket) != -1)
 		{
 			rocket.anim_frame = 1; // begin rocket animation
+			anim_play(rocket.anim, &rocket_explode);
 		}
 
 		// iterate through the animation frames until reaching the last frame
 		if (rocket.status == true && rocket.anim_frame > 0)
 		{
-			rocket.img = rocket_anim[rocket.anim_frame];
+			anim_next(rocket.anim);
 			rocket.anim_frame++;
 			if (rocket.anim_frame == FRAMES)
 			{
@@ -509,6 +520,7 @@ void main(void)
 			if (collision != -1) {
 				bugs[collision]->status = false;
 				bugs[collision]->anim_frame = 1;
+				anim_play(bugs[collision]->anim, &bug_explode);
 				points += 2;
 			}
 		}
@@ -517,11 +529,11 @@ void main(void)
 		{
 			if (asteroids[i]->anim_frame > 0) // if the asteroid collided with the laser
 			{
-				asteroids[i]->img = asteroid_anims[asteroids[i]->type][asteroids[i]->anim_frame]; // iterate through astroid collision frames
+				anim_next(asteroids[i]->anim); // iterate through astroid collision frames
 				asteroids[i]->anim_frame++;
 				if (asteroids[i]->anim_frame == FRAMES)
 				{
-					free(asteroids[i]);
+					free_object(asteroids[i]);
 					asteroids[i] = asteroids[num_asteroids - 1];
 					num_asteroids--;
 				}
@@ -530,1471 +542,87 @@ void main(void)
 
 		for (int i = 0; i < cur_bugs; i++) {
 			if (bugs[i]->status == false) {
-				bugs[i]->img = bug_explode[bugs[i]->anim_frame];
+				anim_next(bugs[i]->anim);
 				bugs[i]->anim_frame++;
 				if (bugs[i]->anim_frame >= FRAMES) {
-					free(bugs[i]);
+					free_object(bugs[i]);
 					bugs[i] = bugs[cur_bugs - 1];
 					cur_bugs--;
 				}
 			}
 		}
 
-		// draw objects to screen if status is true
-		gl_clear(BACKGROUND_COLOR);
+		// record objects into the display list if status is true. the banner
+		// covers the top of the screen, so sprites are clipped to the area below it
+		gl_set_clip(0, BANNER_HEIGHT, gl_get_width(), gl_get_height() - BANNER_HEIGHT);
 		if (rocket.status)
 		{
-			gl_draw_img(rocket.x, rocket.y, rocket.img, SCALE);
+			int rocket_x = fix_round(rocket.x), rocket_y = fix_round(rocket.y);
+			if (rocket.anim_frame == 0) {
+				// bank with the tilt; the turned rockets keep the pivot in place
+				const img_t *bank = rocket_bank[get_bank_frame(fix_round(control_get_tilt()))];
+				gl_cmd_sprite(LAYER_ROCKET, rocket_x + (rocket.img->pivot_x - bank->pivot_x) * SCALE,
+				              rocket_y + (rocket.img->pivot_y - bank->pivot_y) * SCALE, bank, SCALE);
+			} else {
+				gl_cmd_sprite(LAYER_ROCKET, rocket_x, rocket_y, rocket.img, SCALE);
+			}
 		}
 		
+		// objects flash white for the first frames of their explosion
 		for (int i = 0; i < num_asteroids; i++) {
-			gl_draw_img(asteroids[i]->x, asteroids[i]->y, asteroids[i]->img, SCALE);
+			int x = fix_round(asteroids[i]->x), y = fix_round(asteroids[i]->y);
+			int hit = asteroids[i]->anim_frame - 2;
+			if (hit >= 0 && hit < (int)hit_flash.frames)
+				gl_cmd_sprite_palette(LAYER_ASTEROIDS, x, y, asteroids[i]->img, SCALE, hit_flash.palettes[hit]);
+			else
+				gl_cmd_sprite(LAYER_ASTEROIDS, x, y, asteroids[i]->img, SCALE);
 		}
 
 		for (int i = 0; i < cur_bugs; i++) {
-			gl_draw_img(bugs[i]->x, bugs[i]->y, bugs[i]->img, SCALE);
+			int x = fix_round(bugs[i]->x), y = fix_round(bugs[i]->y);
+			int hit = bugs[i]->anim_frame - 2;
+			if (bugs[i]->status == false && hit >= 0 && hit < (int)hit_flash.frames)
+				gl_cmd_sprite_palette(LAYER_BUGS, x, y, bugs[i]->img, SCALE, hit_flash.palettes[hit]);
+			else
+				gl_cmd_sprite(LAYER_BUGS, x, y, bugs[i]->img, SCALE);
 		}
 
 		for (int i = 0; i < cur_lasers; i++)
 		{
-			gl_draw_img(lasers[i]->x, lasers[i]->y, lasers[i]->img, SCALE);
+			gl_cmd_sprite(LAYER_LASERS, fix_round(lasers[i]->x), fix_round(lasers[i]->y), lasers[i]->img, SCALE);
 			// gl_draw_rect(laser.collider->x, laser.collider->y, laser.collider->width,
 			// laser.collider->height, GL_RED);
 		}
 
 		//glitch effect
 		if (glitch == 1) {
-			gl_clear(0xff35f435);
+			gl_cmd_rect(LAYER_GLITCH, 0, 0, gl_get_width(), gl_get_height(), 0xff35f435);
 			glitch = 0;
 		}
 
 		// game over functionality
 		if (game_over == 1)
 		{
-			gl_draw_string(250, 225, "GAME OVER", GL_WHITE);
-			gl_draw_string(150, 275, "Press button to try again!", GL_WHITE);
+			gl_cmd_text(LAYER_TEXT, 250, 225, "GAME OVER", GL_WHITE);
+			gl_cmd_text(LAYER_TEXT, 150, 275, "Press button to try again!", GL_WHITE);
 		}
+		gl_cmd_submit();
 
 		// banner and score counters
-		gl_draw_rect(0, 0, gl_get_width(), BANNER_HEIGHT, BANNER_COLOR);
-		gl_draw_rect(SCALE, SCALE, gl_get_width() - 2 * SCALE, BANNER_HEIGHT - 2 * SCALE, BACKGROUND_COLOR);
-		char *point_str = malloc(20);
-		char *high_score_str = malloc(20);
-		snprintf(point_str, 20, "POINTS: %d", points);
-		snprintf(high_score_str, 20, "HIGH SCORE: %d", high_score);
-		gl_draw_string(10, 10, point_str, GL_WHITE);
-		gl_draw_string(425, 10, high_score_str, GL_WHITE);
+		hud_set_points(points);
+		hud_set_high_score(high_score);
+		hud_draw();
 		gl_swap_buffer();
+		// the DMA engine clears the next buffer while the game logic runs
+		gl_clear(BACKGROUND_COLOR);
+
+		if (++timed_frames == TIMED_FRAMES) {
+			unsigned int now = timer_get_ticks();
+			printf("caches %s: %d us/frame\n", caches ? "on" : "off", (now - timed_start) / TIMED_FRAMES);
+			timed_frames = 0;
+			timed_start = now;
+		}
 	}
 
 	uart_putchar(EOT);
 }
-
-static const img_t laser_img = {
-	1,
-	4,
-	4,
-	"\065\364\065\377\065\364\065\377\065\364\065\377\065\364\065\377",
-};
-
-static const img_t rocket_img = {
-	14,
-	23,
-	4,
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\025\020\022\377"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\025\020\022\377\352Y\204\377\352Y\204\377\025\020\022\377\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020"
-	"\022\377\352Y\204\377\315#U\377\315#U\377\352Y\204\377\025\020\022\377\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\352Y\204"
-	"\377\315#U\377\315#U\377\315#U\377\315#U\377\352Y\204\377\025\020\022\377\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\315#U\377\315"
-	"#U\377\315#U\377\315#U\377\315#U\377\315#U\377\025\020\022\377\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\315#U\377\315#U\377\315#U\377\315"
-	"#U\377\315#U\377\315#U\377\315#U\377\352Y\204\377\025\020\022\377\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\315#U\377\315#U\377\315#U\377\025\020\022"
-	"\377\025\020\022\377\315#U\377\315#U\377\315#U\377\025\020\022\377\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\025\020\022\377\315#U\377\315#U\377\025\020\022\377B\303B"
-	"\377\065\364\065\377\025\020\022\377\315#U\377\315#U\377\025\020\022\377\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\315#U\377\315#U\377\025\020\022\377B\303"
-	"B\377\065\364\065\377\025\020\022\377\315#U\377\315#U\377\025\020\022\377\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\315#U\377\315#U\377\025\020\022\377B\303"
-	"B\377B\303B\377\025\020\022\377\315#U\377\315#U\377\025\020\022\377\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\025\020\022\377\315#U\377\315#U\377\315#U\377\025\020\022"
-	"\377\025\020\022\377\315#U\377\315#U\377\315#U\377\025\020\022\377\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\025\020\022\377\315#U\377\315#U\377\315#U\377\315#U\377"
-	"\315#U\377\315#U\377\315#U\377\315#U\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\025\020\022\377\225\035@\377\315#U\377\315#U\377\315#U\377\315#"
-	"U\377\315#U\377\315#U\377\315#U\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\025\020\022\377\225\035@\377\315#U\377\315#U\377\315#U\377\315#U\377"
-	"\315#U\377\315#U\377\225\035@\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\025\020\022\377\225\035@\377\315#U\377\315#U\377\315#U\377\315#"
-	"U\377\315#U\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\025\020\022\377\225\035@\377\225\035@\377\315#U\377\315#U\377\315#U\377\225"
-	"\035@\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377"
-	"\065\364\065\377\225\035@\377\225\035@\377\225\035@\377\315#U\377\315#U\377\225"
-	"\035@\377\065\364\065\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377"
-	"\065\364\065\377B\303B\377B\303B\377\225\035@\377\225\035@\377\225\035@\377\225"
-	"\035@\377B\303B\377B\303B\377\065\364\065\377\025\020\022\377\000\000\000\000\000\000\000\000\025"
-	"\020\022\377B\303B\377B\303B\377B\303B\377\025\020\022\377\225\035@\377\225\035"
-	"@\377\025\020\022\377B\303B\377B\303B\377B\303B\377\025\020\022\377\000\000\000\000\025"
-	"\020\022\377B\303B\377B\303B\377B\303B\377\022\212\022\377\025\020\022\377\025\020"
-	"\022\377\025\020\022\377\025\020\022\377\022\212\022\377B\303B\377B\303B\377\065\364"
-	"\065\377\025\020\022\377\025\020\022\377B\303B\377\022\212\022\377\022\212\022\377\025"
-	"\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\022\212\022\377B\303"
-	"B\377B\303B\377\025\020\022\377\025\020\022\377\022\212\022\377\025\020\022\377\025\020"
-	"\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\025\020"
-	"\022\377\022\212\022\377\025\020\022\377\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377"
-	"\000\000\000\000",
-};
-
-static const img_t asteroid1_img = {
-	18,
-	16,
-	4,
-	"\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\025\020\022\377\025\020\022\377\025\020\022"
-	"\377\025\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\334k\214\377"
-	"\334k\214\377\355\216\252\377\355\216\252\377\355\216\252\377\355\216\252"
-	"\377\025\020\022\377\025\020\022\377\025\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\334k\214\377\334k\214\377\334"
-	"k\214\377\334k\214\377\355\216\252\377\355\216\252\377\355\216\252\377\334"
-	"k\214\377\277<b\377\277<b\377\355\216\252\377\025\020\022\377\025\020\022\377\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\334k\214\377\334k\214\377\277"
-	"<b\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\355\216\252\377"
-	"\334k\214\377\334k\214\377\355\216\252\377\355\216\252\377\355\216\252\377"
-	"\025\020\022\377\000\000\000\000\000\000\000\000\025\020\022\377\334k\214\377\334k\214\377\355"
-	"\216\252\377\334k\214\377\277<b\377\277<b\377\277<b\377\277<b\377\334k\214"
-	"\377\355\216\252\377\355\216\252\377\334k\214\377\334k\214\377\355\216\252"
-	"\377\355\216\252\377\025\020\022\377\000\000\000\000\025\020\022\377\334k\214\377\355\216"
-	"\252\377\355\216\252\377\355\216\252\377\334k\214\377\277<b\377\277<b\377"
-	"\334k\214\377\334k\214\377\334k\214\377\334k\214\377\277<b\377\334k\214\377"
-	"\334k\214\377\334k\214\377\025\020\022\377\000\000\000\000\025\020\022\377\334k\214\377"
-	"\334k\214\377\334k\214\377\355\216\252\377\355\216\252\377\334k\214\377\334"
-	"k\214\377\334k\214\377\334k\214\377\355\216\252\377\355\216\252\377\334k"
-	"\214\377\277<b\377\277<b\377\334k\214\377\355\216\252\377\025\020\022\377\025"
-	"\020\022\377\277<b\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377"
-	"\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\355\216"
-	"\252\377\355\216\252\377\334k\214\377\277<b\377\334k\214\377\355\216\252"
-	"\377\025\020\022\377\000\000\000\000\025\020\022\377\334k\214\377\334k\214\377\334k\214"
-	"\377\334k\214\377\334k\214\377\277<b\377\277<b\377\334k\214\377\334k\214"
-	"\377\334k\214\377\334k\214\377\277<b\377\277<b\377\334k\214\377\355\216\252"
-	"\377\025\020\022\377\000\000\000\000\025\020\022\377\277<b\377\334k\214\377\334k\214\377"
-	"\277<b\377\277<b\377\277<b\377\277<b\377\334k\214\377\334k\214\377\334k\214"
-	"\377\334k\214\377\277<b\377\334k\214\377\334k\214\377\355\216\252\377\025"
-	"\020\022\377\000\000\000\000\000\000\000\000\025\020\022\377\277<b\377\334k\214\377\334k\214\377"
-	"\277<b\377\277<b\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377"
-	"\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\025\020\022"
-	"\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\334k\214\377\334k\214\377\334k"
-	"\214\377\334k\214\377\334k\214\377\334k\214\377\277<b\377\277<b\377\334k"
-	"\214\377\334k\214\377\334k\214\377\334k\214\377\025\020\022\377\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\025\020\022\377\277<b\377\334k\214\377\334k\214\377\334"
-	"k\214\377\334k\214\377\277<b\377\277<b\377\277<b\377\277<b\377\334k\214\377"
-	"\277<b\377\277<b\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\025\020\022\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\277<b\377"
-	"\277<b\377\334k\214\377\334k\214\377\277<b\377\025\020\022\377\025\020\022\377"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\277<b\377\277"
-	"<b\377\277<b\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\277"
-	"<b\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\025\020\022\377\025\020\022\377\025\020\022\377\025\020\022\377\025"
-	"\020\022\377\025\020\022\377\025\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000",
-};
-
-static const img_t asteroid2_img = {
-  19, 16, 4,
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\025"
-  "\020\022\377\025\020\022\377\025\020\022\377\025\020\022\377\025\020\022\377\025\020\022\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\025\020\022\377\334k\214\377\355\216\252\377\355\216\252\377"
-  "\355\216\252\377\334k\214\377\334k\214\377\355\216\252\377\025\020\022\377\025"
-  "\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\025\020\022\377\277<b\377\277<b\377\334k\214\377\355\216\252\377\355\216"
-  "\252\377\355\216\252\377\334k\214\377\355\216\252\377\355\216\252\377\355"
-  "\216\252\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022"
-  "\377\025\020\022\377\355\216\252\377\355\216\252\377\355\216\252\377\277<b\377"
-  "\334k\214\377\355\216\252\377\334k\214\377\334k\214\377\334k\214\377\334"
-  "k\214\377\355\216\252\377\355\216\252\377\025\020\022\377\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\025\020\022\377\277<b\377\277<b\377\334k\214\377\334k\214\377\334k\214"
-  "\377\355\216\252\377\355\216\252\377\355\216\252\377\334k\214\377\277<b\377"
-  "\277<b\377\334k\214\377\334k\214\377\355\216\252\377\025\020\022\377\000\000\000\000"
-  "\000\000\000\000\025\020\022\377\334k\214\377\277<b\377\277<b\377\277<b\377\277<b\377"
-  "\334k\214\377\334k\214\377\334k\214\377\334k\214\377\355\216\252\377\355"
-  "\216\252\377\277<b\377\277<b\377\334k\214\377\334k\214\377\025\020\022\377\000"
-  "\000\000\000\025\020\022\377\334k\214\377\334k\214\377\277<b\377\277<b\377\277<b\377"
-  "\334k\214\377\355\216\252\377\355\216\252\377\277<b\377\277<b\377\334k\214"
-  "\377\334k\214\377\355\216\252\377\355\216\252\377\277<b\377\334k\214\377"
-  "\355\216\252\377\025\020\022\377\025\020\022\377\334k\214\377\334k\214\377\334"
-  "k\214\377\334k\214\377\334k\214\377\334k\214\377\355\216\252\377\334k\214"
-  "\377\277<b\377\277<b\377\277<b\377\334k\214\377\334k\214\377\334k\214\377"
-  "\355\216\252\377\334k\214\377\334k\214\377\025\020\022\377\025\020\022\377\277"
-  "<b\377\277<b\377\277<b\377\277<b\377\334k\214\377\334k\214\377\334k\214\377"
-  "\334k\214\377\334k\214\377\277<b\377\277<b\377\277<b\377\277<b\377\334k\214"
-  "\377\334k\214\377\334k\214\377\334k\214\377\025\020\022\377\025\020\022\377\277"
-  "<b\377\277<b\377\277<b\377\334k\214\377\334k\214\377\277<b\377\277<b\377"
-  "\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\277<b\377"
-  "\277<b\377\334k\214\377\334k\214\377\334k\214\377\025\020\022\377\025\020\022\377"
-  "\277<b\377\277<b\377\334k\214\377\334k\214\377\334k\214\377\277<b\377\277"
-  "<b\377\277<b\377\277<b\377\334k\214\377\334k\214\377\334k\214\377\334k\214"
-  "\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\025\020\022\377\000\000"
-  "\000\000\025\020\022\377\334k\214\377\334k\214\377\334k\214\377\277<b\377\277<b"
-  "\377\277<b\377\277<b\377\277<b\377\334k\214\377\334k\214\377\334k\214\377"
-  "\334k\214\377\334k\214\377\334k\214\377\277<b\377\025\020\022\377\000\000\000\000\000"
-  "\000\000\000\025\020\022\377\277<b\377\334k\214\377\334k\214\377\334k\214\377\334"
-  "k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377"
-  "\277<b\377\277<b\377\277<b\377\277<b\377\277<b\377\025\020\022\377\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\025\020\022\377\277<b\377\277<b\377\334k\214\377\334k\214\377"
-  "\334k\214\377\334k\214\377\334k\214\377\334k\214\377\277<b\377\277<b\377"
-  "\277<b\377\277<b\377\277<b\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\025\020\022\377\025\020\022\377\277<b\377\277<b\377\277<b\377\334k\214"
-  "\377\334k\214\377\334k\214\377\025\020\022\377\025\020\022\377\025\020\022\377\025"
-  "\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\025\020\022\377\025\020\022\377\025\020\022\377\025\020\022\377\025\020"
-  "\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000",
-};
-
-static const img_t asteroid3_img = {
-  27, 24, 4,
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\025\020\022\377\025\020\022\377\025"
-  "\020\022\377\025\020\022\377\025\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\025\020\022\377"
-  "\355\216\252\377\355\216\252\377\355\216\252\377\355\216\252\377\355\216"
-  "\252\377\355\216\252\377\355\216\252\377\025\020\022\377\025\020\022\377\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\025\020\022\377\025\020\022\377\025\020\022\377\025\020\022\377\355"
-  "\216\252\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214"
-  "\377\334k\214\377\334k\214\377\334k\214\377\355\216\252\377\355\216\252\377"
-  "\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\025\020\022\377\025\020\022\377\334k\214\377\355\216\252\377\355\216"
-  "\252\377\355\216\252\377\334k\214\377\334k\214\377\355\216\252\377\355\216"
-  "\252\377\277<b\377\277<b\377\277<b\377\277<b\377\334k\214\377\334k\214\377"
-  "\334k\214\377\355\216\252\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\277<b\377\334k\214\377\334k\214\377"
-  "\334k\214\377\334k\214\377\355\216\252\377\334k\214\377\334k\214\377\334"
-  "k\214\377\355\216\252\377\355\216\252\377\355\216\252\377\355\216\252\377"
-  "\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\025\020\022"
-  "\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\277<b\377"
-  "\277<b\377\277<b\377\355\216\252\377\355\216\252\377\355\216\252\377\334"
-  "k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377"
-  "\334k\214\377\355\216\252\377\355\216\252\377\355\216\252\377\334k\214\377"
-  "\355\216\252\377\334k\214\377\355\216\252\377\025\020\022\377\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\025\020\022\377\334k\214\377\334k\214\377\355\216\252\377"
-  "\355\216\252\377\355\216\252\377\334k\214\377\334k\214\377\334k\214\377\277"
-  "<b\377\277<b\377\277<b\377\334k\214\377\334k\214\377\334k\214\377\355\216"
-  "\252\377\355\216\252\377\355\216\252\377\355\216\252\377\355\216\252\377"
-  "\334k\214\377\334k\214\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022"
-  "\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334"
-  "k\214\377\334k\214\377\334k\214\377\277<b\377\277<b\377\277<b\377\277<b\377"
-  "\277<b\377\334k\214\377\334k\214\377\334k\214\377\355\216\252\377\355\216"
-  "\252\377\355\216\252\377\334k\214\377\334k\214\377\334k\214\377\334k\214"
-  "\377\025\020\022\377\000\000\000\000\000\000\000\000\025\020\022\377\334k\214\377\334k\214\377"
-  "\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\355\216"
-  "\252\377\277<b\377\277<b\377\277<b\377\277<b\377\277<b\377\277<b\377\334"
-  "k\214\377\334k\214\377\355\216\252\377\334k\214\377\334k\214\377\334k\214"
-  "\377\277<b\377\334k\214\377\334k\214\377\025\020\022\377\000\000\000\000\025\020\022\377"
-  "\334k\214\377\334k\214\377\277<b\377\277<b\377\277<b\377\277<b\377\334k\214"
-  "\377\334k\214\377\334k\214\377\355\216\252\377\355\216\252\377\355\216\252"
-  "\377\277<b\377\277<b\377\277<b\377\334k\214\377\355\216\252\377\355\216\252"
-  "\377\334k\214\377\277<b\377\277<b\377\277<b\377\277<b\377\334k\214\377\025"
-  "\020\022\377\000\000\000\000\025\020\022\377\334k\214\377\334k\214\377\277<b\377\277<"
-  "b\377\277<b\377\277<b\377\277<b\377\334k\214\377\334k\214\377\334k\214\377"
-  "\334k\214\377\334k\214\377\334k\214\377\355\216\252\377\334k\214\377\334"
-  "k\214\377\334k\214\377\355\216\252\377\277<b\377\277<b\377\277<b\377\277"
-  "<b\377\277<b\377\334k\214\377\334k\214\377\025\020\022\377\025\020\022\377\334"
-  "k\214\377\334k\214\377\277<b\377\277<b\377\277<b\377\277<b\377\334k\214\377"
-  "\334k\214\377\334k\214\377\277<b\377\277<b\377\334k\214\377\334k\214\377"
-  "\277<b\377\334k\214\377\334k\214\377\334k\214\377\355\216\252\377\355\216"
-  "\252\377\355\216\252\377\277<b\377\355\216\252\377\355\216\252\377\334k\214"
-  "\377\334k\214\377\025\020\022\377\025\020\022\377\334k\214\377\334k\214\377\334"
-  "k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377"
-  "\277<b\377\277<b\377\277<b\377\277<b\377\277<b\377\277<b\377\277<b\377\334"
-  "k\214\377\334k\214\377\334k\214\377\334k\214\377\355\216\252\377\355\216"
-  "\252\377\355\216\252\377\355\216\252\377\355\216\252\377\334k\214\377\025"
-  "\020\022\377\025\020\022\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377"
-  "\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\277<b\377"
-  "\277<b\377\277<b\377\277<b\377\277<b\377\334k\214\377\334k\214\377\334k\214"
-  "\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334"
-  "k\214\377\334k\214\377\334k\214\377\025\020\022\377\025\020\022\377\334k\214\377"
-  "\277<b\377\277<b\377\277<b\377\334k\214\377\334k\214\377\334k\214\377\334"
-  "k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377"
-  "\334k\214\377\334k\214\377\334k\214\377\334k\214\377\277<b\377\277<b\377"
-  "\277<b\377\334k\214\377\334k\214\377\277<b\377\277<b\377\025\020\022\377\000\000"
-  "\000\000\025\020\022\377\334k\214\377\277<b\377\277<b\377\277<b\377\277<b\377\334"
-  "k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377"
-  "\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\277<b\377"
-  "\277<b\377\277<b\377\277<b\377\334k\214\377\277<b\377\025\020\022\377\025\020"
-  "\022\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\334k\214\377\277<b\377\277<"
-  "b\377\277<b\377\277<b\377\334k\214\377\334k\214\377\334k\214\377\334k\214"
-  "\377\277<b\377\277<b\377\334k\214\377\334k\214\377\334k\214\377\334k\214"
-  "\377\277<b\377\277<b\377\277<b\377\277<b\377\334k\214\377\025\020\022\377\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\334k\214\377"
-  "\334k\214\377\334k\214\377\277<b\377\334k\214\377\334k\214\377\277<b\377"
-  "\277<b\377\277<b\377\277<b\377\277<b\377\277<b\377\277<b\377\334k\214\377"
-  "\277<b\377\277<b\377\277<b\377\277<b\377\334k\214\377\025\020\022\377\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\277<b\377"
-  "\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\277<b\377"
-  "\277<b\377\277<b\377\277<b\377\277<b\377\277<b\377\334k\214\377\277<b\377"
-  "\277<b\377\277<b\377\277<b\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\277<b\377\277<b\377"
-  "\277<b\377\334k\214\377\334k\214\377\334k\214\377\277<b\377\277<b\377\277"
-  "<b\377\277<b\377\277<b\377\334k\214\377\334k\214\377\334k\214\377\334k\214"
-  "\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\025\020\022\377\025\020\022\377\277"
-  "<b\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334"
-  "k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\025\020\022\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\277<b\377\277"
-  "<b\377\277<b\377\277<b\377\334k\214\377\334k\214\377\277<b\377\277<b\377"
-  "\025\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\025\020\022\377\025\020\022\377\025\020\022\377\277<b\377\277<"
-  "b\377\277<b\377\025\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\025\020\022\377\025\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
-};
-
-
-static const img_t rocket_e1 = {
-	14,
-	23,
-	4,
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\025\020\022\377"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\352Y\204\377\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\352"
-	"Y\204\377\315#U\377\315#U\377\352Y\204\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\352Y\204\377\315#U\377\315"
-	"#U\377\315#U\377\315#U\377\352Y\204\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377\315#U\377\315#U\377\315#U"
-	"\377\315#U\377\315#U\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\025\020\022\377\315#U\377\315#U\377\315#U\377\315#U\377\315#U\377\315#"
-	"U\377\315#U\377\352Y\204\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\025\020\022\377\315#U\377\315#U\377\315#U\377\025\020\022\377\025\020\022\377\315"
-	"#U\377\000\000\000\000\315#U\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025"
-	"\020\022\377\000\000\000\000\000\000\000\000\025\020\022\377B\303B\377\065\364\065\377\025\020\022"
-	"\377\315#U\377\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020"
-	"\022\377\315#U\377\000\000\000\000\025\020\022\377B\303B\377\000\000\000\000\025\020\022\377\315"
-	"#U\377\315#U\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377"
-	"\315#U\377\315#U\377\000\000\000\000B\303B\377B\303B\377\025\020\022\377\315#U\377\315"
-	"#U\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377\315#U\377"
-	"\315#U\377\025\020\022\377\025\020\022\377\315#U\377\315#U\377\315#U\377\025\020"
-	"\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\315#U\377\315#U\377"
-	"\315#U\377\315#U\377\315#U\377\315#U\377\315#U\377\315#U\377\025\020\022\377"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\225\035@\377\315#U\377\000\000\000"
-	"\000\315#U\377\315#U\377\315#U\377\000\000\000\000\315#U\377\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\025\020\022\377\225\035@\377\315#U\377\315#U\377\315#U\377"
-	"\315#U\377\315#U\377\315#U\377\225\035@\377\025\020\022\377\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\225\035@\377\315#U\377\315#U\377\000\000\000"
-	"\000\000\000\000\000\315#U\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\025\020\022\377\225\035@\377\225\035@\377\000\000\000\000\000\000\000\000\000\000\000\000\225"
-	"\035@\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\065"
-	"\364\065\377\000\000\000\000\225\035@\377\000\000\000\000\315#U\377\315#U\377\225\035@\377\065"
-	"\364\065\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\065\364\065\377"
-	"B\303B\377B\303B\377\225\035@\377\000\000\000\000\225\035@\377\225\035@\377B\303B\377"
-	"B\303B\377\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\025\020\022\377B\303B\377B\303"
-	"B\377B\303B\377\025\020\022\377\000\000\000\000\225\035@\377\025\020\022\377B\303B\377\000"
-	"\000\000\000B\303B\377\025\020\022\377\000\000\000\000\000\000\000\000B\303B\377B\303B\377B\303B\377"
-	"\022\212\022\377\025\020\022\377\025\020\022\377\025\020\022\377\025\020\022\377\022\212"
-	"\022\377B\303B\377B\303B\377\065\364\065\377\000\000\000\000\025\020\022\377B\303B\377"
-	"\022\212\022\377\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000B\303B\377B\303B\377\025\020\022\377\025\020\022\377\022\212\022\377\025"
-	"\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000",
-};
-
-static const img_t rocket_e2 = {
-	14,
-	23,
-	4,
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\352Y\204\377\000\000\000\000\000\000"
-	"\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\025\020\022\377\000\000\000\000\352Y\204\377\000\000\000\000\315#U\377\000\000\000\000\352Y\204\377"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\352Y\204\377\000\000"
-	"\000\000\000\000\000\000\315#U\377\315#U\377\000\000\000\000\000\000\000\000\352Y\204\377\025\020\022\377"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\315#U\377\000\000\000\000\315#U\377"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377\025\020\022\377\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\315#U\377\000\000\000\000\315#U\377\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\315#U\377\352Y\204\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\315#U\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\315#U\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377B\303B\377"
-	"\065\364\065\377\000\000\000\000\000\000\000\000\315#U\377\000\000\000\000\025\020\022\377\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\315#U\377\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377\000\000\000\000\000\000\000\000"
-	"\025\020\022\377\315#U\377\315#U\377\025\020\022\377\000\000\000\000\000\000\000\000\025\020\022\377"
-	"\315#U\377\315#U\377\000\000\000\000\000\000\000\000B\303B\377B\303B\377\000\000\000\000\025\020\022"
-	"\377\315#U\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377\315#U\377"
-	"\000\000\000\000\315#U\377\025\020\022\377\025\020\022\377\000\000\000\000\315#U\377\000\000\000\000\000"
-	"\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\025\020\022\377\315#U\377\315#U\377\000\000"
-	"\000\000\000\000\000\000\315#U\377\315#U\377\000\000\000\000\315#U\377\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377\315"
-	"#U\377\000\000\000\000\315#U\377\000\000\000\000\315#U\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\225\035@\377\315#U\377\000\000\000\000\315#U\377\000\000\000\000\315#U\377\000\000\000\000\000\000"
-	"\000\000\315#U\377\225\035@\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022"
-	"\377\225\035@\377\000\000\000\000\315#U\377\315#U\377\000\000\000\000\000\000\000\000\000\000\000\000\315"
-	"#U\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\225\035@"
-	"\377\000\000\000\000\225\035@\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\225\035@\377\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\000\000\000\000\225\035"
-	"@\377\000\000\000\000\315#U\377\000\000\000\000\315#U\377\225\035@\377\065\364\065\377\025\020"
-	"\022\377\000\000\000\000\025\020\022\377\000\000\000\000B\303B\377B\303B\377\000\000\000\000\225\035@"
-	"\377\000\000\000\000\225\035@\377\000\000\000\000\225\035@\377B\303B\377B\303B\377\000\000\000\000"
-	"\000\000\000\000\000\000\000\000B\303B\377\000\000\000\000B\303B\377\000\000\000\000\025\020\022\377\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\025\020\022\377B\303B\377\000\000\000\000B\303B\377\025\020\022\377\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377B\303B\377B\303B"
-	"\377\022\212\022\377\025\020\022\377\000\000\000\000\000\000\000\000\025\020\022\377\022\212\022\377"
-	"B\303B\377B\303B\377\065\364\065\377\000\000\000\000\025\020\022\377B\303B\377\022\212"
-	"\022\377\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000B\303B\377\000\000\000\000\000\000\000\000\022\212\022\377\025\020\022\377\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\025\020\022\377",
-};
-
-static const img_t rocket_e3 = {
-	14,
-	23,
-	4,
-	"\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377\000"
-	"\000\000\000\352Y\204\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\352Y\204\377\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\315#U\377\000\000\000\000\315"
-	"#U\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\315#U\377\000\000\000\000\315#U\377\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\352Y\204\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\315"
-	"#U\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\315#"
-	"U\377\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\315#U\377\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377\315"
-	"#U\377\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022"
-	"\377\315#U\377\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377\000\000\000\000\000\000\000\000\315#U\377"
-	"\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025"
-	"\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377\315#U\377\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\315#U\377\000\000\000\000\000\000\000\000\225\035@\377\315#U\377\000\000\000\000\315"
-	"#U\377\000\000\000\000\000\000\000\000\315#U\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\225"
-	"\035@\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\225\035@\377\000\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\225\035@\377\065\364\065"
-	"\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"B\303B\377\000\000\000\000\225\035@\377\000\000\000\000\000\000\000\000\225\035@\377\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377\000\000\000\000\025\020"
-	"\022\377\000\000\000\000\225\035@\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000"
-	"\000\000\000\000B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303"
-	"B\377\000\000\000\000\022\212\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\025\020\022\377\022\212\022\377B\303B\377\000\000\000\000\065\364\065\377\000\000\000\000\022\212"
-	"\022\377\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377",
-};
-
-static const img_t rocket_e4 = {
-	14,
-	23,
-	4,
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\315#U\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\352Y\204\377\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\315#U\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\225\035@\377\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\315#U\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\315#U\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\225\035@\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377"
-	"\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\225\035@\377\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
-};
-
-static const img_t asteroid1_e1 = {
-	18,
-	16,
-	4,
-	"\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\025\020\022\377\000\000\000\000\025\020\022\377\025"
-	"\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\334k\214\377"
-	"\355\216\252\377\355\216\252\377\355\216\252\377\355\216\252\377\000\000\000\000"
-	"\025\020\022\377\025\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\025\020\022\377\334k\214\377\000\000\000\000\334k\214\377\334k\214\377"
-	"\355\216\252\377\355\216\252\377\000\000\000\000\334k\214\377\277<b\377\277<b\377"
-	"\355\216\252\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\025"
-	"\020\022\377\334k\214\377\334k\214\377\025\020\022\377\025\020\022\377\334k\214\377"
-	"\334k\214\377\334k\214\377\355\216\252\377\334k\214\377\334k\214\377\355"
-	"\216\252\377\000\000\000\000\355\216\252\377\025\020\022\377\000\000\000\000\334k\214\377\000"
-	"\000\000\000\334k\214\377\334k\214\377\355\216\252\377\334k\214\377\000\000\000\000\277"
-	"<b\377\277<b\377\277<b\377\334k\214\377\000\000\000\000\355\216\252\377\334k\214"
-	"\377\000\000\000\000\355\216\252\377\355\216\252\377\025\020\022\377\000\000\000\000\000\000\000\000"
-	"\334k\214\377\355\216\252\377\355\216\252\377\000\000\000\000\000\000\000\000\277<b\377\277"
-	"<b\377\334k\214\377\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\334"
-	"k\214\377\000\000\000\000\025\020\022\377\000\000\000\000\025\020\022\377\334k\214\377\334k\214"
-	"\377\000\000\000\000\000\000\000\000\355\216\252\377\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\355\216\252\377\355\216\252\377\000\000\000\000\277<b\377\277<b\377\000\000\000\000\000\000"
-	"\000\000\025\020\022\377\025\020\022\377\277<b\377\334k\214\377\334k\214\377\334k\214"
-	"\377\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\355\216\252"
-	"\377\355\216\252\377\334k\214\377\277<b\377\334k\214\377\355\216\252\377"
-	"\025\020\022\377\000\000\000\000\025\020\022\377\334k\214\377\334k\214\377\334k\214\377"
-	"\334k\214\377\334k\214\377\277<b\377\277<b\377\334k\214\377\334k\214\377"
-	"\334k\214\377\334k\214\377\277<b\377\277<b\377\000\000\000\000\000\000\000\000\025\020\022\377"
-	"\000\000\000\000\025\020\022\377\277<b\377\334k\214\377\000\000\000\000\277<b\377\277<b\377"
-	"\277<b\377\277<b\377\334k\214\377\000\000\000\000\334k\214\377\025\020\022\377\000\000\000"
-	"\000\334k\214\377\334k\214\377\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\025\020\022\377\277<b\377\277<b\377\334k\214\377\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\334k\214\377\025\020\022\377\334k\214\377\334k\214\377\334k\214"
-	"\377\000\000\000\000\334k\214\377\000\000\000\000\355\216\252\377\025\020\022\377\334k\214\377"
-	"\334k\214\377\025\020\022\377\334k\214\377\334k\214\377\334k\214\377\277<b\377"
-	"\277<b\377\334k\214\377\334k\214\377\000\000\000\000\334k\214\377\025\020\022\377\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\277<b\377\334k\214\377\000\000\000"
-	"\000\334k\214\377\334k\214\377\277<b\377\277<b\377\277<b\377\277<b\377\334"
-	"k\214\377\000\000\000\000\277<b\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\025\020\022\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377"
-	"\277<b\377\277<b\377\334k\214\377\334k\214\377\277<b\377\000\000\000\000\025\020\022"
-	"\377\334k\214\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\277<b\377\334k\214\377\334k\214\377\000\000\000\000\000\000\000\000\277<b"
-	"\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\025\020\022\377\025\020\022\377\000\000\000\000\025\020\022\377\025\020\022"
-	"\377\025\020\022\377\000\000\000\000\025\020\022\377\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000"
-	"\000\000\000\000\000",
-};
-
-static const img_t asteroid1_e2 = {
-	18,
-	16,
-	4,
-	"\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\025\020\022\377\000\000\000\000\025\020\022\377\025"
-	"\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\334k\214"
-	"\377\355\216\252\377\355\216\252\377\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\025\020\022\377\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022"
-	"\377\025\020\022\377\000\000\000\000\000\000\000\000\334k\214\377\334k\214\377\355\216\252\377"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\355\216\252\377\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\025\020\022\377\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020"
-	"\022\377\025\020\022\377\334k\214\377\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\355\216\252\377\025\020\022\377\000\000\000\000\334k\214\377"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\277<b\377\000\000\000\000\000"
-	"\000\000\000\334k\214\377\000\000\000\000\355\216\252\377\334k\214\377\000\000\000\000\355\216"
-	"\252\377\355\216\252\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\334k\214\377\334k\214\377\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\334k\214\377\334k\214\377\000\000\000\000\025\020\022\377\000\000\000\000\025"
-	"\020\022\377\277<b\377\334k\214\377\000\000\000\000\000\000\000\000\355\216\252\377\334k\214"
-	"\377\000\000\000\000\000\000\000\000\000\000\000\000\355\216\252\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\025\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\334k\214\377\355\216\252\377\025\020\022\377\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214"
-	"\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\334k\214\377\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\277<b\377\277"
-	"<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\277<b\377\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214"
-	"\377\025\020\022\377\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\355\216\252\377\000\000"
-	"\000\000\025\020\022\377\277<b\377\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000"
-	"\000\000\000\025\020\022\377\025\020\022\377\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\334k\214\377\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020"
-	"\022\377\334k\214\377\025\020\022\377\000\000\000\000\025\020\022\377\334k\214\377\000\000\000"
-	"\000\000\000\000\000\355\216\252\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\025\020"
-	"\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000",
-};
-
-static const img_t asteroid1_e3 = {
-	18,
-	16,
-	4,
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\355\216\252\377\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020"
-	"\022\377\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\277<b\377\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\334k\214\377"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000"
-	"\000\000\000\355\216\252\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\025\020\022\377\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022"
-	"\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000",
-};
-
-static const img_t asteroid1_e4 = {
-	18,
-	16,
-	4,
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\355\216\252\377\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277"
-	"<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025"
-	"\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\355\216\252\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-	"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
-};
-
-static const img_t asteroid2_e1 = {
-  19, 16, 4,
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\025"
-  "\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\355\216\252\377\000\000\000\000\000"
-  "\000\000\000\025\020\022\377\334k\214\377\355\216\252\377\000\000\000\000\000\000\000\000\334k\214"
-  "\377\334k\214\377\355\216\252\377\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\277<b\377\277"
-  "<b\377\334k\214\377\355\216\252\377\355\216\252\377\355\216\252\377\334k"
-  "\214\377\355\216\252\377\355\216\252\377\355\216\252\377\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\355\216\252\377\355"
-  "\216\252\377\355\216\252\377\277<b\377\000\000\000\000\355\216\252\377\334k\214\377"
-  "\334k\214\377\334k\214\377\334k\214\377\355\216\252\377\355\216\252\377\025"
-  "\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\277<b\377\277<b\377\334k"
-  "\214\377\000\000\000\000\334k\214\377\355\216\252\377\355\216\252\377\000\000\000\000\334"
-  "k\214\377\277<b\377\277<b\377\000\000\000\000\334k\214\377\355\216\252\377\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\277<b\377\277<b\377\277<b\377\277"
-  "<b\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\355\216\252\377"
-  "\000\000\000\000\277<b\377\277<b\377\334k\214\377\334k\214\377\000\000\000\000\000\000\000\000\025"
-  "\020\022\377\334k\214\377\000\000\000\000\000\000\000\000\277<b\377\277<b\377\334k\214\377"
-  "\000\000\000\000\355\216\252\377\277<b\377\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\277<b\377\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\334k\214"
-  "\377\000\000\000\000\334k\214\377\334k\214\377\334k\214\377\355\216\252\377\334k"
-  "\214\377\277<b\377\277<b\377\000\000\000\000\355\216\252\377\000\000\000\000\000\000\000\000\355"
-  "\216\252\377\334k\214\377\334k\214\377\025\020\022\377\025\020\022\377\277<b\377"
-  "\277<b\377\277<b\377\277<b\377\334k\214\377\000\000\000\000\334k\214\377\334k\214"
-  "\377\334k\214\377\277<b\377\277<b\377\277<b\377\277<b\377\334k\214\377\334"
-  "k\214\377\334k\214\377\334k\214\377\000\000\000\000\000\000\000\000\277<b\377\277<b\377\277"
-  "<b\377\334k\214\377\334k\214\377\277<b\377\277<b\377\334k\214\377\334k\214"
-  "\377\334k\214\377\334k\214\377\334k\214\377\277<b\377\277<b\377\000\000\000\000\334"
-  "k\214\377\334k\214\377\025\020\022\377\025\020\022\377\000\000\000\000\277<b\377\334k\214"
-  "\377\334k\214\377\000\000\000\000\277<b\377\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000\334"
-  "k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377"
-  "\334k\214\377\025\020\022\377\000\000\000\000\025\020\022\377\334k\214\377\334k\214\377"
-  "\334k\214\377\277<b\377\000\000\000\000\355\216\252\377\000\000\000\000\000\000\000\000\334k\214"
-  "\377\334k\214\377\000\000\000\000\334k\214\377\334k\214\377\334k\214\377\000\000\000\000"
-  "\025\020\022\377\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\334k\214\377\334"
-  "k\214\377\000\000\000\000\334k\214\377\000\000\000\000\334k\214\377\334k\214\377\334k\214"
-  "\377\277<b\377\277<b\377\277<b\377\277<b\377\277<b\377\025\020\022\377\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\334k\214\377\334k\214\377\334"
-  "k\214\377\334k\214\377\334k\214\377\334k\214\377\277<b\377\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\334k\214\377\000\000"
-  "\000\000\025\020\022\377\025\020\022\377\000\000\000\000\277<b\377\277<b\377\334k\214\377\334"
-  "k\214\377\334k\214\377\025\020\022\377\025\020\022\377\000\000\000\000\025\020\022\377\025"
-  "\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\025\020\022\377\025\020\022\377\025\020\022\377\000\000\000\000\025\020\022\377\025\020\022\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
-};
-
-static const img_t asteroid2_e2 = {
-  19, 16, 4,
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022"
-  "\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\355\216\252\377\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\355"
-  "\216\252\377\355\216\252\377\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\355\216\252\377\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\355\216\252\377\000\000\000"
-  "\000\355\216\252\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\355\216\252\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022"
-  "\377\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\355\216\252\377\000\000\000\000\277<b\377\334k\214\377\355\216\252\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\277<b\377\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377"
-  "\000\000\000\000\334k\214\377\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\277<b\377\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000\334k\214\377\000\000\000"
-  "\000\025\020\022\377\025\020\022\377\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334"
-  "k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\277"
-  "<b\377\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\334k\214\377\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377"
-  "\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\025\020\022\377\334k\214\377\334k\214\377\000\000\000\000\277<b\377\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000"
-  "\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\334k\214\377"
-  "\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\025\020\022\377\025\020\022\377\000\000\000"
-  "\000\000\000\000\000\277<b\377\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\334k\214\377\025\020\022\377\025\020\022\377\000\000\000\000\025\020\022\377"
-  "\025\020\022\377\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000",
-};
-
-static const img_t asteroid2_e3 = {
-  19, 16, 4,
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\355\216\252\377\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\355\216\252\377\334k\214\377\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\355\216\252\377\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334"
-  "k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\277<b\377\000\000\000\000"
-  "\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\277<b\377\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000"
-  "\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000",
-};
-
-static const img_t asteroid2_e4 = {
-  19, 16, 4,
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000",
-};
-
-static const img_t asteroid3_e1 = {
-  27, 24, 4,
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\025\020\022\377"
-  "\000\000\000\000\025\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\355\216\252\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\355\216\252"
-  "\377\000\000\000\000\355\216\252\377\355\216\252\377\355\216\252\377\355\216\252"
-  "\377\355\216\252\377\025\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\277<"
-  "b\377\025\020\022\377\025\020\022\377\025\020\022\377\025\020\022\377\000\000\000\000\334k\214"
-  "\377\334k\214\377\000\000\000\000\334k\214\377\334k\214\377\334k\214\377\334k\214"
-  "\377\334k\214\377\000\000\000\000\355\216\252\377\025\020\022\377\334k\214\377\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000\025\020\022\377"
-  "\000\000\000\000\334k\214\377\355\216\252\377\000\000\000\000\355\216\252\377\334k\214\377"
-  "\334k\214\377\355\216\252\377\000\000\000\000\277<b\377\277<b\377\277<b\377\277<"
-  "b\377\334k\214\377\334k\214\377\334k\214\377\355\216\252\377\000\000\000\000\000\000"
-  "\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\277"
-  "<b\377\000\000\000\000\000\000\000\000\334k\214\377\334k\214\377\355\216\252\377\334k\214"
-  "\377\334k\214\377\334k\214\377\355\216\252\377\355\216\252\377\355\216\252"
-  "\377\355\216\252\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377"
-  "\334k\214\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\025\020\022\377\277<b\377\277<b\377\277<b\377\000\000\000\000\355\216\252\377\355"
-  "\216\252\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214"
-  "\377\334k\214\377\334k\214\377\355\216\252\377\355\216\252\377\355\216\252"
-  "\377\334k\214\377\355\216\252\377\334k\214\377\355\216\252\377\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\334k\214\377\355\216"
-  "\252\377\355\216\252\377\355\216\252\377\000\000\000\000\334k\214\377\334k\214\377"
-  "\277<b\377\277<b\377\277<b\377\334k\214\377\334k\214\377\000\000\000\000\355\216"
-  "\252\377\355\216\252\377\355\216\252\377\355\216\252\377\355\216\252\377"
-  "\334k\214\377\334k\214\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022"
-  "\377\334k\214\377\000\000\000\000\334k\214\377\334k\214\377\334k\214\377\334k\214"
-  "\377\000\000\000\000\000\000\000\000\277<b\377\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\334k\214"
-  "\377\334k\214\377\334k\214\377\355\216\252\377\355\216\252\377\355\216\252"
-  "\377\334k\214\377\334k\214\377\334k\214\377\000\000\000\000\025\020\022\377\000\000\000\000"
-  "\000\000\000\000\025\020\022\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377"
-  "\334k\214\377\334k\214\377\334k\214\377\355\216\252\377\277<b\377\277<b\377"
-  "\277<b\377\277<b\377\277<b\377\277<b\377\334k\214\377\334k\214\377\355\216"
-  "\252\377\334k\214\377\334k\214\377\334k\214\377\277<b\377\334k\214\377\334"
-  "k\214\377\025\020\022\377\000\000\000\000\025\020\022\377\334k\214\377\334k\214\377\277"
-  "<b\377\277<b\377\277<b\377\277<b\377\334k\214\377\334k\214\377\334k\214\377"
-  "\355\216\252\377\355\216\252\377\355\216\252\377\277<b\377\277<b\377\277"
-  "<b\377\334k\214\377\355\216\252\377\355\216\252\377\334k\214\377\277<b\377"
-  "\277<b\377\277<b\377\277<b\377\334k\214\377\025\020\022\377\000\000\000\000\000\000\000\000"
-  "\334k\214\377\334k\214\377\277<b\377\277<b\377\000\000\000\000\277<b\377\277<b\377"
-  "\334k\214\377\334k\214\377\000\000\000\000\334k\214\377\334k\214\377\334k\214\377"
-  "\355\216\252\377\334k\214\377\334k\214\377\334k\214\377\355\216\252\377\277"
-  "<b\377\277<b\377\277<b\377\277<b\377\277<b\377\334k\214\377\334k\214\377"
-  "\025\020\022\377\025\020\022\377\334k\214\377\334k\214\377\277<b\377\277<b\377"
-  "\000\000\000\000\277<b\377\334k\214\377\334k\214\377\334k\214\377\277<b\377\277<"
-  "b\377\334k\214\377\334k\214\377\277<b\377\000\000\000\000\000\000\000\000\334k\214\377\355"
-  "\216\252\377\355\216\252\377\355\216\252\377\277<b\377\355\216\252\377\355"
-  "\216\252\377\334k\214\377\334k\214\377\025\020\022\377\025\020\022\377\334k\214"
-  "\377\334k\214\377\334k\214\377\334k\214\377\000\000\000\000\000\000\000\000\334k\214\377"
-  "\334k\214\377\277<b\377\277<b\377\277<b\377\277<b\377\277<b\377\277<b\377"
-  "\000\000\000\000\000\000\000\000\334k\214\377\334k\214\377\334k\214\377\355\216\252\377\355"
-  "\216\252\377\000\000\000\000\355\216\252\377\355\216\252\377\000\000\000\000\025\020\022\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\334k\214\377\355\216\252\377\000\000\000"
-  "\000\334k\214\377\334k\214\377\334k\214\377\277<b\377\277<b\377\277<b\377\277"
-  "<b\377\277<b\377\000\000\000\000\334k\214\377\334k\214\377\334k\214\377\334k\214"
-  "\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334"
-  "k\214\377\025\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000\277<b\377\277<b\377\334"
-  "k\214\377\000\000\000\000\334k\214\377\334k\214\377\334k\214\377\000\000\000\000\000\000\000\000"
-  "\334k\214\377\334k\214\377\000\000\000\000\334k\214\377\334k\214\377\000\000\000\000\277"
-  "<b\377\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\277<b\377\000\000\000\000\025\020\022\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\277<b\377\277<b\377\277<b\377\334k\214"
-  "\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334"
-  "k\214\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\277<b\377\277"
-  "<b\377\277<b\377\277<b\377\334k\214\377\277<b\377\025\020\022\377\025\020\022\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\277<b\377\277<b\377\277<b\377"
-  "\277<b\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\277<b\377"
-  "\277<b\377\334k\214\377\334k\214\377\334k\214\377\334k\214\377\277<b\377"
-  "\277<b\377\277<b\377\277<b\377\334k\214\377\025\020\022\377\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\334k\214\377\334k\214\377\334"
-  "k\214\377\277<b\377\334k\214\377\000\000\000\000\277<b\377\277<b\377\277<b\377\000"
-  "\000\000\000\277<b\377\277<b\377\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\277"
-  "<b\377\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000"
-  "\000\000\000\000\000\000\025\020\022\377\277<b\377\334k\214\377\000\000\000\000\334k\214\377\334"
-  "k\214\377\334k\214\377\277<b\377\277<b\377\277<b\377\277<b\377\277<b\377"
-  "\277<b\377\334k\214\377\277<b\377\277<b\377\277<b\377\277<b\377\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025"
-  "\020\022\377\000\000\000\000\000\000\000\000\277<b\377\334k\214\377\334k\214\377\334k\214\377"
-  "\277<b\377\277<b\377\277<b\377\277<b\377\000\000\000\000\334k\214\377\334k\214\377"
-  "\334k\214\377\334k\214\377\025\020\022\377\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\025\020\022\377"
-  "\025\020\022\377\000\000\000\000\277<b\377\334k\214\377\334k\214\377\334k\214\377\334"
-  "k\214\377\000\000\000\000\334k\214\377\334k\214\377\334k\214\377\334k\214\377\334"
-  "k\214\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025"
-  "\020\022\377\277<b\377\277<b\377\277<b\377\000\000\000\000\000\000\000\000\334k\214\377\277"
-  "<b\377\277<b\377\000\000\000\000\025\020\022\377\355\216\252\377\000\000\000\000\000\000\000\000\277"
-  "<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\025\020\022\377\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\277<b\377\025\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000",
-};
-
-static const img_t asteroid3_e2 = {
-  27, 24, 4,
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\025\020\022\377\000\000\000\000\355\216\252\377\000\000\000\000\000\000\000\000\000\000\000\000\355"
-  "\216\252\377\355\216\252\377\000\000\000\000\000\000\000\000\355\216\252\377\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000"
-  "\000\000\000\000\277<b\377\025\020\022\377\025\020\022\377\000\000\000\000\025\020\022\377\000\000\000\000"
-  "\000\000\000\000\334k\214\377\000\000\000\000\334k\214\377\000\000\000\000\334k\214\377\000\000\000\000\334"
-  "k\214\377\334k\214\377\334k\214\377\000\000\000\000\355\216\252\377\025\020\022\377"
-  "\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000\025\020\022"
-  "\377\000\000\000\000\334k\214\377\355\216\252\377\000\000\000\000\355\216\252\377\334k\214"
-  "\377\000\000\000\000\355\216\252\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334"
-  "k\214\377\277<b\377\334k\214\377\334k\214\377\000\000\000\000\355\216\252\377\000\000"
-  "\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000\000"
-  "\000\000\000\000\000\334k\214\377\334k\214\377\355\216\252\377\334k\214\377\000\000\000\000"
-  "\334k\214\377\355\216\252\377\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\277<b\377\277<b\377\000\000\000\000\355\216"
-  "\252\377\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\334k\214\377\334k\214"
-  "\377\000\000\000\000\000\000\000\000\000\000\000\000\355\216\252\377\000\000\000\000\355\216\252\377\334"
-  "k\214\377\355\216\252\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022"
-  "\377\000\000\000\000\334k\214\377\355\216\252\377\000\000\000\000\355\216\252\377\000\000\000\000"
-  "\334k\214\377\000\000\000\000\000\000\000\000\277<b\377\277<b\377\334k\214\377\000\000\000\000\000"
-  "\000\000\000\334k\214\377\000\000\000\000\355\216\252\377\000\000\000\000\355\216\252\377\000\000\000"
-  "\000\355\216\252\377\000\000\000\000\334k\214\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\334k\214\377\334k\214\377\334k\214\377\334k\214\377\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\334"
-  "k\214\377\334k\214\377\000\000\000\000\355\216\252\377\355\216\252\377\000\000\000\000\334"
-  "k\214\377\000\000\000\000\334k\214\377\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377"
-  "\000\000\000\000\277<b\377\277<b\377\000\000\000\000\000\000\000\000\277<b\377\334k\214\377\334k"
-  "\214\377\355\216\252\377\334k\214\377\334k\214\377\334k\214\377\000\000\000\000\334"
-  "k\214\377\334k\214\377\000\000\000\000\000\000\000\000\334k\214\377\277<b\377\277<b\377\277"
-  "<b\377\000\000\000\000\334k\214\377\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\355\216"
-  "\252\377\277<b\377\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\334k\214\377\277<b\377\000\000\000\000\277<b\377\000\000\000\000\334k\214\377\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334"
-  "k\214\377\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334"
-  "k\214\377\334k\214\377\000\000\000\000\355\216\252\377\277<b\377\000\000\000\000\277<b\377"
-  "\000\000\000\000\277<b\377\334k\214\377\000\000\000\000\334k\214\377\334k\214\377\277<b\377"
-  "\277<b\377\000\000\000\000\277<b\377\334k\214\377\334k\214\377\000\000\000\000\277<b\377"
-  "\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\355\216\252\377\000\000\000\000\355\216\252\377\277<b\377\000\000\000\000\000\000\000\000"
-  "\334k\214\377\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214"
-  "\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334"
-  "k\214\377\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377"
-  "\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\277<b\377\277"
-  "<b\377\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\334k\214\377\334k\214\377\000\000\000\000\000\000\000\000\355\216\252\377\000\000\000\000\355\216"
-  "\252\377\355\216\252\377\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\334k\214\377"
-  "\355\216\252\377\000\000\000\000\334k\214\377\334k\214\377\000\000\000\000\000\000\000\000\277<b"
-  "\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\334k\214\377\334k\214\377\334k\214"
-  "\377\334k\214\377\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\334k\214\377\000\000\000\000"
-  "\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000"
-  "\000\334k\214\377\000\000\000\000\334k\214\377\334k\214\377\000\000\000\000\277<b\377\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\334k\214\377\277<b\377\000\000\000\000\025\020\022\377\000\000\000\000\277"
-  "<b\377\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\334k\214\377\000\000\000\000\000\000\000\000"
-  "\334k\214\377\000\000\000\000\334k\214\377\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\277<b\377\277<b\377\000\000\000\000\277<b\377"
-  "\000\000\000\000\025\020\022\377\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\277<b\377\000\000"
-  "\000\000\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\277<b\377\000\000"
-  "\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\277<b\377\277<b\377"
-  "\000\000\000\000\277<b\377\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025"
-  "\020\022\377\334k\214\377\334k\214\377\000\000\000\000\277<b\377\334k\214\377\000\000\000"
-  "\000\277<b\377\277<b\377\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214"
-  "\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000\025\020\022\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\334k\214\377\000"
-  "\000\000\000\334k\214\377\000\000\000\000\334k\214\377\277<b\377\277<b\377\277<b\377\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000\277<b\377\277<b"
-  "\377\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\277<b\377\334k\214\377\000\000\000\000\334k\214"
-  "\377\000\000\000\000\277<b\377\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\334k\214\377\334k\214\377\025\020\022\377\000\000\000\000\000\000\000\000\277<b\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\025\020\022\377\025\020"
-  "\022\377\000\000\000\000\277<b\377\000\000\000\000\334k\214\377\334k\214\377\334k\214\377"
-  "\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\334k\214\377\000"
-  "\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\277"
-  "<b\377\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\334k\214\377\000\000\000\000\277<b\377"
-  "\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\025\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000\000"
-  "\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
-};
-
-static const img_t asteroid3_e3 = {
-  27, 24, 4,
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\025\020\022\377\000\000\000\000\000\000\000\000\025"
-  "\020\022\377\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020"
-  "\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\355\216\252\377\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\355\216\252\377\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\277<b\377\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\355\216\252\377\000\000\000\000\355\216\252\377\000\000\000\000"
-  "\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\355\216\252\377\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\334"
-  "k\214\377\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\334k"
-  "\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000\334k\214"
-  "\377\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000"
-  "\000\277<b\377\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\334k\214\377\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\277<b\377\277<b\377\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334"
-  "k\214\377\334k\214\377\000\000\000\000\000\000\000\000\355\216\252\377\000\000\000\000\000\000\000\000\355"
-  "\216\252\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\334k"
-  "\214\377\000\000\000\000\334k\214\377\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\277<b\377\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277<b"
-  "\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\334k\214\377\000\000\000\000\025\020\022\377\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334"
-  "k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000\025\020\022\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000",
-};
-
-static const img_t asteroid3_e4 = {
-  27, 24, 4,
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214"
-  "\377\000\000\000\000\334k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334"
-  "k\214\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214"
-  "\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\334k\214\377\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\277<b\377\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\277<b\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
-};
-
-static const img_t bug_walk1 = {
-  19, 11, 4,
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377\065\364\065\377\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\065\364\065\377\065\364\065\377\065\364\065\377\065\364\065\377\065\364\065\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377\065\364\065\377\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377\065\364\065\377\065\364\065\377\065\364"
-  "\065\377\065\364\065\377\065\364\065\377\065\364\065\377\065\364\065\377\065\364\065"
-  "\377\065\364\065\377B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377\025\020\022\377\025\020\022\377\065\364"
-  "\065\377\065\364\065\377\065\364\065\377\025\020\022\377\025\020\022\377\065\364\065\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000B\303B\377B\303B\377B\303B\377\025\020\022\377B\303B\377\025\020\022\377"
-  "B\303B\377B\303B\377\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377B\303B\377B\303B\377\352Y\204\377\315"
-  "#U\377B\303B\377B\303B\377B\303B\377\315#U\377\352Y\204\377B\303B\377B\303"
-  "B\377B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377\000\000"
-  "\000\000\000\000\000\000B\303B\377B\303B\377B\303B\377B\303B\377B\303B\377B\303B\377"
-  "B\303B\377B\303B\377B\303B\377\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000B\303B\377\000\000\000\000\000\000\000\000B\303"
-  "B\377B\303B\377B\303B\377B\303B\377B\303B\377\000\000\000\000\000\000\000\000B\303B\377\000"
-  "\000\000\000\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303"
-  "B\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000",
-};
-
-static const img_t bug_walk2 = {
-  19, 11, 4,
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377\065\364\065\377\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\065\364"
-  "\065\377\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303"
-  "B\377\000\000\000\000\000\000\000\000\065\364\065\377\065\364\065\377\065\364\065\377\065\364\065"
-  "\377\065\364\065\377\000\000\000\000\000\000\000\000B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377\065\364\065\377"
-  "\065\364\065\377\065\364\065\377\065\364\065\377\065\364\065\377\065\364\065\377\065"
-  "\364\065\377\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\065\364\065\377B\303B\377\000\000\000\000\065\364\065\377\025\020\022\377\025\020"
-  "\022\377\065\364\065\377\065\364\065\377\065\364\065\377\025\020\022\377\025\020\022\377"
-  "\065\364\065\377B\303B\377B\303B\377\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\065\364\065\377\000\000\000\000\000\000\000\000B\303B\377B\303B\377B\303B\377B\303B\377\025"
-  "\020\022\377B\303B\377\025\020\022\377B\303B\377B\303B\377\065\364\065\377\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000B\303B\377\352Y\204\377\315#U\377B\303B\377B\303B\377B\303B\377\315"
-  "#U\377\352Y\204\377B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377B\303B\377B\303B\377B\303B\377B\303"
-  "B\377B\303B\377B\303B\377B\303B\377B\303B\377B\303B\377B\303B\377\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377\000\000\000\000\000\000\000"
-  "\000\000\000\000\000B\303B\377B\303B\377B\303B\377B\303B\377B\303B\377\000\000\000\000\000\000"
-  "\000\000\000\000\000\000B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\065"
-  "\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
-};
-
-static const img_t bug_walk3 = {
-  19, 11, 4,
-  "\000\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "B\303B\377\000\000\000\000\065\364\065\377\065\364\065\377\065\364\065\377\065\364\065\377"
-  "\065\364\065\377\000\000\000\000B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\065\364\065\377B\303B\377\000\000\000\000\065\364\065\377\065\364\065"
-  "\377\065\364\065\377\065\364\065\377\065\364\065\377\065\364\065\377\065\364\065\377"
-  "\065\364\065\377\065\364\065\377\000\000\000\000B\303B\377\065\364\065\377\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\065\364\065\377\000\000\000\000\000\000\000\000B\303B\377\065\364\065\377\025\020"
-  "\022\377\025\020\022\377\065\364\065\377\065\364\065\377\065\364\065\377\025\020\022\377"
-  "\025\020\022\377\065\364\065\377B\303B\377\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377B\303B\377B\303B\377"
-  "\025\020\022\377B\303B\377\025\020\022\377B\303B\377B\303B\377\065\364\065\377\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000B\303B\377\352Y\204\377\315#U\377B\303B\377B\303B\377B\303B\377\315"
-  "#U\377\352Y\204\377B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000B\303B\377B\303B\377B\303B\377B\303B\377B\303B\377B\303"
-  "B\377B\303B\377B\303B\377B\303B\377B\303B\377B\303B\377B\303B\377B\303B\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000B\303B\377B\303B\377B\303B\377B\303B\377B\303B\377\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
-};
-
-static const img_t bug_walk4 = {
-  19, 11, 4,
-  "\000\000\000\000\000\000\000\000\065\364\065\377\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377"
-  "\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377"
-  "\000\000\000\000\000\000\000\000\065\364\065\377\065\364\065\377\065\364\065\377\065\364\065\377"
-  "\065\364\065\377\000\000\000\000\000\000\000\000B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377\065\364\065\377\065\364"
-  "\065\377\065\364\065\377\065\364\065\377\065\364\065\377\065\364\065\377\065\364\065"
-  "\377\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\065\364\065\377B\303B\377B\303B\377\065\364\065\377\025\020\022\377\025\020\022"
-  "\377\065\364\065\377\065\364\065\377\065\364\065\377\025\020\022\377\025\020\022\377"
-  "\065\364\065\377B\303B\377B\303B\377\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377B\303B\377B\303B\377\025\020"
-  "\022\377B\303B\377\025\020\022\377B\303B\377B\303B\377\065\364\065\377\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000B\303B\377\352Y\204\377\315#U\377B\303B\377B\303B\377B\303B\377\315"
-  "#U\377\352Y\204\377B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377B\303B\377B\303B\377B\303B"
-  "\377B\303B\377B\303B\377B\303B\377B\303B\377B\303B\377\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377\000\000\000\000"
-  "\000\000\000\000B\303B\377B\303B\377B\303B\377B\303B\377B\303B\377\000\000\000\000\000\000\000"
-  "\000B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\065\364"
-  "\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000",
-};
-
-static const img_t bug_e1 = {
-  19, 11, 4,
-  "\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\065\364"
-  "\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377\000\000\000\000"
-  "\000\000\000\000\065\364\065\377\065\364\065\377\065\364\065\377\065\364\065\377\065\364\065"
-  "\377\000\000\000\000\065\364\065\377B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377\065\364\065\377\025\020\022"
-  "\377\065\364\065\377\065\364\065\377\377\377\377\377\377\377\377\377\025\020\022"
-  "\377\065\364\065\377\000\000\000\000\352Y\204\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\065\364\065\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\025\020\022\377\065\364\065\377\065\364\065\377\377\377\377\377\377"
-  "\377\377\377\025\020\022\377\352Y\204\377\352Y\204\377\352Y\204\377\065\364\065"
-  "\377\000\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\315#U\377\315#U\377B\303B\377\025"
-  "\020\022\377\343\377\000\377\343\377\000\377\352Y\204\377\352Y\204\377\352Y\204"
-  "\377\343\377\000\377\065\364\065\377\000\000\000\000\035\003\371\377\035\003\371\377\035\003\371"
-  "\377\035\003\371\377\035\003\371\377B\303B\377\352Y\204\377\315#U\377\315#U\377"
-  "B\303B\377B\303B\377\315#U\377\352Y\204\377\352Y\204\377\352Y\204\377\352"
-  "Y\204\377\000\000\000\000\000\000\000\000\000\000\000\000\035\003\371\377\035\003\371\377\035\003\371\377"
-  "\035\003\371\377\035\003\371\377\000\000\000\000B\303B\377\315#U\377\315#U\377B\303B\377"
-  "B\303B\377B\303B\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377\315#U\377\315#U\377B\303B\377B\303"
-  "B\377B\303B\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000",
-};
-
-static const img_t bug_e2 = {
-  19, 11, 4,
-  "\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377\000\000"
-  "\000\000\000\000\000\000\065\364\065\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\025\020\022\377\000\000\000\000\065\364\065\377B\303B\377\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\065\364\065\377\000\000\000\000\315#U\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\352Y\204\377\000\000\000\000\000\000\000\000\000\000\000\000\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\000\000\000\000\000\000\000\000\315#U\377\065\364\065\377\000\000"
-  "\000\000\343\377\000\377\343\377\000\377\025\020\022\377\343\377\000\377\343\377\000\377"
-  "\343\377\000\377\343\377\000\377\065\364\065\377\000\000\000\000\000\000\000\000\065\364\065\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377\000\000\000\000\315#U\377\000\000\000\000\000\000\000\000\343"
-  "\377\000\377\343\377\000\377\025\020\022\377\343\377\000\377\343\377\000\377\343\377"
-  "\000\377\343\377\000\377\000\000\000\000\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\352Y\204\377\352Y\204\377\352Y\204\377\352Y\204\377\352Y\204\377\352Y"
-  "\204\377B\303B\377\315#U\377\025\020\022\377\000\000\000\000\352Y\204\377\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\003\371\377\035\003\371\377"
-  "\035\003\371\377\035\003\371\377\315#U\377B\303B\377B\303B\377\000\000\000\000B\303B\377"
-  "\025\020\022\377\000\000\000\000B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\035\003\371\377\035\003\371\377\035\003\371\377\035\003\371\377\315#U"
-  "\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377B\303B\377"
-  "\000\000\000\000\000\000\000\000\315#U\377\000\000\000\000B\303B\377B\303B\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
-};
-
-static const img_t bug_e3 = {
-  19, 11, 4,
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377\065\364"
-  "\065\377\000\000\000\000\065\364\065\377\000\000\000\000\025\020\022\377\025\020\022\377\025\020\022"
-  "\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\065\364"
-  "\065\377\000\000\000\000\000\000\000\000\315#U\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022"
-  "\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\035\003\371\377\035\003\371\377"
-  "\035\003\371\377\035\003\371\377\035\003\371\377\035\003\371\377\065\364\065\377\065\364"
-  "\065\377\000\000\000\000\000\000\000\000\000\000\000\000\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\000\000\000\000\000\000\000\000B\303B\377\035\003\371\377"
-  "\035\003\371\377\035\003\371\377\035\003\371\377\035\003\371\377\035\003\371\377\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\025\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\352Y\204\377\352Y\204\377\000\000\000\000\352"
-  "Y\204\377\343\377\000\377\343\377\000\377\343\377\000\377\025\020\022\377\025\020\022"
-  "\377\352Y\204\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\000\000\000\000\000\000\000\000\000\000\000\000\352Y\204\377\352Y\204\377\352Y\204\377\352"
-  "Y\204\377\343\377\000\377\343\377\000\377\343\377\000\377\343\377\000\377\343\377"
-  "\000\377\025\020\022\377\025\020\022\377\000\000\000\000\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\343\377\000\377\343\377\000\377\343\377\000\377\343\377\000\377\343\377"
-  "\000\377\343\377\000\377\025\020\022\377\025\020\022\377\000\000\000\000\025\020\022\377\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377\000\000\000\000\000\000\000\000"
-  "\025\020\022\377\025\020\022\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\315#U\377\000\000\000\000\000\000\000\000\025\020\022\377\025\020\022\377\025\020\022\377\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
-};
-
-static const img_t bug_e4 = {
-  19, 11, 4,
-  "\000\000\000\000\000\000\000\000\000\000\000\000\065\364\065\377\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\377\377\377\377\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\343\377\000\377\343\377\000\377\343\377\000\377\343\377\000\377\343\377\000"
-  "\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\352Y\204\377\352Y\204\377\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\343\377\000\377\343"
-  "\377\000\377\343\377\000\377\343\377\000\377\343\377\000\377\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\003\371\377\035\003\371\377\000\000\000\000\000"
-  "\000\000\000\315#U\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000B\303B\377\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\315#U\377\000\000\000\000\000\000\000\000\000\000\000\000B\303"
-  "B\377\025\020\022\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
-};
-
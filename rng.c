@@ -0,0 +1,53 @@
+#include "rng.h"
+
+#define MULTIPLIER 6364136223846793005ULL
+#define INCREMENT  1442695040888963407ULL // any odd number
+
+static unsigned long long state;
+static unsigned int seed = 0;
+
+void rng_seed(unsigned int s)
+{
+	seed = s;
+	state = 0;
+	rng_next();
+	state += s;
+	rng_next();
+}
+
+unsigned int rng_get_seed(void)
+{
+	return seed;
+}
+
+unsigned int rng_next(void)
+{
+	unsigned long long old = state;
+	state = old * MULTIPLIER + INCREMENT;
+	unsigned int xorshifted = ((old >> 18) ^ old) >> 27;
+	unsigned int rot = old >> 59;
+	return (xorshifted >> rot) | (xorshifted << ((32 - rot) & 31));
+}
+
+/* the high word of a 32x32-bit product is a value scaled into 0 to n - 1.
+   products whose low word falls below 2^32 mod n would make some values
+   more likely than others and are drawn again (Lemire, 2019). the
+   threshold is only worked out, with a division, in that rare case */
+unsigned int rng_below(unsigned int n)
+{
+	unsigned long long m = (unsigned long long)rng_next() * n;
+	unsigned int low = (unsigned int)m;
+	if (low < n) {
+		unsigned int threshold = -n % n;
+		while (low < threshold) {
+			m = (unsigned long long)rng_next() * n;
+			low = (unsigned int)m;
+		}
+	}
+	return m >> 32;
+}
+
+int rng_range(int lo, int hi)
+{
+	return lo + (int)rng_below((unsigned int)(hi - lo) + 1);
+}
@@ -0,0 +1,56 @@
+#ifndef RNG_H
+#define RNG_H
+
+/*
+ * Seedable pseudo-random numbers for the game.
+ *
+ * The generator is PCG32: a 64-bit linear congruential state, output
+ * through a xorshift and a random rotation. The same seed always gives
+ * the same numbers, so a game can be replayed from its seed.
+ *
+ * Numbers in a range are scaled with a multiply and a shift instead of
+ * taken with `%`, which the ARM1176 has no instruction for, and are
+ * exactly uniform.
+ */
+
+/*
+ * `rng_seed`
+ *
+ * Restart the sequence of numbers from seed.
+ *
+ * @param seed  any value, such as `timer_get_ticks` when the player starts
+ */
+void rng_seed(unsigned int seed);
+
+/*
+ * `rng_get_seed`
+ *
+ * @return  the seed the current sequence started from
+ */
+unsigned int rng_get_seed(void);
+
+/*
+ * `rng_next`
+ *
+ * @return  the next pseudo-random value, in the range 0 to UINT_MAX
+ */
+unsigned int rng_next(void);
+
+/*
+ * `rng_below`
+ *
+ * @param n  the number of possible values, at least 1
+ * @return   a pseudo-random value in the range 0 to n - 1
+ */
+unsigned int rng_below(unsigned int n);
+
+/*
+ * `rng_range`
+ *
+ * @param lo  the smallest possible value
+ * @param hi  the largest possible value, at least lo
+ * @return    a pseudo-random value in the range lo to hi, both included
+ */
+int rng_range(int lo, int hi);
+
+#endif
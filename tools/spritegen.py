@@ -0,0 +1,593 @@
+#!/usr/bin/env python3
+"""
+Convert GIMP C-source image dumps into a header of native sprites.
+
+Usage: spritegen.py [--effects art/effects.txt] [--anims art/anims.txt]
+                    [--frames art/frames.txt] [--rotations art/rotations.txt]
+                    [--compile-scale N]
+                    [--compile SPRITE ...] -o sprites.h art/*.c
+
+Each input is a dump written by GIMP's "Export as C source" with the
+default options (RGBA or RGB). The struct name in the dump becomes the
+name of the sprite. The generated header holds:
+
+  - the pixels of all sprites as 4-bit palette indices, two per byte
+    with the left pixel in the low nibble, packed into one sheet. Each
+    sprite is trimmed to the bounding box of its opaque pixels, and the
+    boxes are shelf-packed into rows of SHEET_WIDTH pixels so that
+    every sheet row is one aligned cache line; index 0 is transparent
+  - the palette, as color_t words ready to be stored into the
+    framebuffer (0xAARRGGBB, the colors as painted) and premultiplied
+    by alpha. All sprites share one
+    palette when the art uses at most 15 colors, otherwise each sprite
+    gets its own
+  - the opaque spans of every trimmed row, so drawing never tests for
+    transparency, and a collision mask with one word per trimmed row,
+    bit 0 leftmost, each kept in one array for all sprites
+  - the frame table, one gl_sprite_t per sprite with the untrimmed size
+    kept as width/height, its box in the sheet, and its pivot and
+    collider box. Each sprite name is defined as its table entry
+
+The optional frames file gives sprites a pivot and a collider box (see
+art/frames.txt). By default the pivot is the center of the image and
+the collider is the trimmed box.
+
+The optional rotations file asks for turned copies of sprites (see
+art/rotations.txt). Each copy is rotated about the sprite's pivot by
+three shears done in 16.16 fixed point, which moves every pixel to a
+distinct place, so no pixel is lost or invented and no new colors
+appear. The copies become ordinary sprites, grown to fit, with the
+pivot moved along; a table lists them from the most counterclockwise
+to the most clockwise.
+
+The optional effects file describes palette effects (see the comment at
+the top of art/effects.txt), each emitted as a gl_effect_t holding one
+remapped copy of the shared palette per frame.
+
+The optional animations file lists sequences of same-sized sprites (see
+art/anims.txt). Each becomes an anim_t that keeps the first frame as a
+sprite and every later frame as a delta: the runs of pixels that differ
+from the frame before, with their new palette indices.
+
+With --compile-scale N the sprites named with --compile also get a
+compiled draw function: one store per target pixel of its opaque pixels
+drawn N times their size, with the colors as constants. gl_draw_img
+calls it in place of the generic loop when the sprite needs no
+clipping. The code grows with the square of N, so only sprites drawn
+every frame and seldom clipped are worth it; the rest keep to spans.
+"""
+
+import argparse
+import math
+import os
+import re
+import sys
+
+DUMP_RE = re.compile(
+    r'static\s+const\s+struct\s*\{.*?\}\s*(\w+)\s*=\s*\{\s*'
+    r'(\d+)\s*,\s*(\d+)\s*,\s*(\d+)\s*,\s*'
+    r'((?:"(?:[^"\\]|\\.)*"\s*)+)', re.S)
+STRING_RE = re.compile(r'"((?:[^"\\]|\\.)*)"')
+ESCAPES = {'n': 10, 't': 9, 'r': 13, '\\': 92, '"': 34, "'": 39, '?': 63}
+
+MAX_WIDTH = 32  # collision mask rows are a single word
+MAX_COLORS = 15  # palette index 0 is reserved for transparent
+SHEET_WIDTH = 64  # sheet rows are 32 bytes, one ARM1176 cache line
+
+
+def unescape(s):
+    """Bytes of the body of a C string literal."""
+    out = bytearray()
+    i = 0
+    while i < len(s):
+        if s[i] != '\\':
+            out.append(ord(s[i]))
+            i += 1
+            continue
+        j = i + 1
+        if s[j] in '01234567':
+            k = j
+            while k < len(s) and k < j + 3 and s[k] in '01234567':
+                k += 1
+            out.append(int(s[j:k], 8))
+            i = k
+        else:
+            out.append(ESCAPES[s[j]])
+            i = j + 1
+    return bytes(out)
+
+
+class Image:
+    def __init__(self, name, width, height, rgba):
+        self.name = name
+        self.width = width
+        self.height = height
+        self.rgba = rgba  # list of (r, g, b, a) tuples, row by row
+
+    def pixel(self, x, y):
+        return self.rgba[y * self.width + x]
+
+
+def load_dump(path):
+    text = open(path).read()
+    m = DUMP_RE.search(text)
+    if not m:
+        sys.exit('%s: not a GIMP C-source image dump' % path)
+    name, w, h, bpp, literals = m.groups()
+    w, h, bpp = int(w), int(h), int(bpp)
+    if bpp not in (3, 4):
+        sys.exit('%s: unsupported bytes per pixel %d' % (path, bpp))
+    data = b''.join(unescape(s) for s in STRING_RE.findall(literals))
+    if len(data) < w * h * bpp:
+        sys.exit('%s: expected %d bytes of pixel data, found %d' % (path, w * h * bpp, len(data)))
+    rgba = []
+    for i in range(w * h):
+        p = data[i * bpp:(i + 1) * bpp]
+        rgba.append((p[0], p[1], p[2], p[3] if bpp == 4 else 0xff))
+    return Image(name, w, h, rgba)
+
+
+def premultiply(c, a):
+    t = c * a + 128
+    return (t + (t >> 8)) >> 8
+
+
+def color_word(px):
+    """The color_t for an RGBA pixel in framebuffer order, premultiplied, 0 if transparent."""
+    r, g, b, a = px
+    if a == 0:
+        return 0
+    r, g, b = premultiply(r, a), premultiply(g, a), premultiply(b, a)
+    return (a << 24) | (r << 16) | (g << 8) | b
+
+
+def trim_box(img):
+    """Bounding box (x, y, w, h) of the opaque pixels, empty box if none."""
+    xs = [x for y in range(img.height) for x in range(img.width) if img.pixel(x, y)[3]]
+    ys = [y for y in range(img.height) for x in range(img.width) if img.pixel(x, y)[3]]
+    if not xs:
+        return 0, 0, 0, 0
+    return min(xs), min(ys), max(xs) - min(xs) + 1, max(ys) - min(ys) + 1
+
+
+def row_spans(words):
+    """(x, len) runs of the nonzero words in one row."""
+    spans = []
+    x = 0
+    while x < len(words):
+        if words[x]:
+            start = x
+            while x < len(words) and words[x]:
+                x += 1
+            spans.append((start, x - start))
+        else:
+            x += 1
+    return spans
+
+
+def emit_array(out, ctype, name, values, fmt, per_line):
+    out.append('static const %s %s[] = {' % (ctype, name))
+    if not values:
+        values = [0]  # C does not allow empty initializers
+    for i in range(0, len(values), per_line):
+        out.append('\t' + ', '.join(fmt % v for v in values[i:i + per_line]) + ',')
+    out.append('};')
+
+
+def sprite_colors(img):
+    """The distinct opaque color words of an image, in order of appearance."""
+    colors = []
+    for px in img.rgba:
+        w = color_word(px)
+        if w and w not in colors:
+            colors.append(w)
+    return colors
+
+
+def emit_palette(out, name, colors):
+    if len(colors) > MAX_COLORS:
+        sys.exit('%s: %d colors, at most %d fit in 4 bits' % (name, len(colors), MAX_COLORS))
+    emit_array(out, 'color_t', name, [0] + colors + [0] * (MAX_COLORS - len(colors)), '0x%08x', 8)
+
+
+def emit_compiled(out, name, rows, scale):
+    """A straight-line function storing the opaque words of the trimmed rows, scaled."""
+    out.append('static void %s_compiled(color_t *dst, int pitch)' % name)
+    out.append('{')
+    for y, row in enumerate(rows):
+        stores = ['dst[%d] = 0x%08x;' % (x * scale + i, w)
+                  for x, w in enumerate(row) if w for i in range(scale)]
+        for sub in range(scale):
+            for i in range(0, len(stores), 4):
+                out.append('\t' + ' '.join(stores[i:i + 4]))
+            if y < len(rows) - 1 or sub < scale - 1:
+                out.append('\tdst += pitch;')
+    out.append('}')
+
+
+class Sprite:
+    """A sprite as it goes into the sheet: its trimmed box and what is derived from it."""
+
+    def __init__(self, img, palette, palette_name, meta):
+        if img.width > MAX_WIDTH:
+            sys.exit('%s: wider than %d pixels' % (img.name, MAX_WIDTH))
+        self.img = img
+        self.palette_name = palette_name
+        self.trim = trim_box(img)
+        tx, ty, tw, th = self.trim
+        self.words = [[color_word(img.pixel(tx + x, ty + y)) for x in range(tw)]
+                      for y in range(th)]
+        self.indices = [[palette.index(w) + 1 if w else 0 for w in row] for row in self.words]
+        self.spans, self.row_index = [], [0]
+        for row in self.words:
+            self.spans += row_spans(row)
+            self.row_index.append(len(self.spans))
+        self.mask = [sum(1 << x for x, w in enumerate(row) if w) for row in self.words]
+        self.pivot = meta.get('pivot', (img.width // 2, img.height // 2))
+        self.collider = meta.get('collider', self.trim)
+        self.sheet_x = self.sheet_y = 0
+
+
+def load_frames(path):
+    """{sprite name: {'pivot': (x, y), 'collider': (x, y, w, h)}}"""
+    frames = {}
+    for num, line in enumerate(open(path), 1):
+        words = line.split('#')[0].split()
+        if not words:
+            continue
+        meta = frames.setdefault(words[0], {})
+        for word in words[1:]:
+            key, _, value = word.partition('=')
+            try:
+                numbers = tuple(int(v) for v in value.split(','))
+            except ValueError:
+                numbers = ()
+            if (key, len(numbers)) not in (('pivot', 2), ('collider', 4)):
+                sys.exit('%s:%d: expected pivot=x,y or collider=x,y,w,h, not %s' % (path, num, word))
+            meta[key] = numbers
+    return frames
+
+
+def pack_sheet(sprites):
+    """Shelf-packs the trimmed boxes into the sheet, tallest first, and
+    returns the height of the sheet. Boxes start on an even column so
+    every row of a box starts on a byte."""
+    x = y = shelf = 0
+    for sp in sorted(sprites, key=lambda sp: (-sp.trim[3], sp.img.name)):
+        w = sp.trim[2] + (sp.trim[2] & 1)
+        if x + w > SHEET_WIDTH:
+            x, y, shelf = 0, y + shelf, 0
+        sp.sheet_x, sp.sheet_y = x, y
+        x += w
+        shelf = max(shelf, sp.trim[3])
+    return y + shelf
+
+
+def emit_sheet(out, sprites, compile_scale):
+    height = pack_sheet(sprites)
+    sheet = [[0] * SHEET_WIDTH for _ in range(height)]
+    for sp in sprites:
+        for y, row in enumerate(sp.indices):
+            sheet[sp.sheet_y + y][sp.sheet_x:sp.sheet_x + len(row)] = row
+    packed = [row[i] | (row[i + 1] << 4) for row in sheet for i in range(0, SHEET_WIDTH, 2)]
+
+    out.append('')
+    out.append('// all sprite pixels, packed into one sheet of %d x %d indices' % (SHEET_WIDTH, height))
+    out.append('#define SPRITE_SHEET_STRIDE %d' % (SHEET_WIDTH // 2))
+    emit_array(out, 'unsigned char __attribute__((aligned(%d)))' % (SHEET_WIDTH // 2),
+               'sprite_sheet', packed, '0x%02x', SHEET_WIDTH // 2)
+
+    spans, rows, masks = [], [], []
+    for sp in sprites:
+        sp.spans_at, sp.rows_at, sp.mask_at = len(spans), len(rows), len(masks)
+        spans += sp.spans
+        rows += sp.row_index
+        masks += sp.mask
+    out.append('static const gl_span_t sprite_spans[] = {')
+    for i in range(0, max(len(spans), 1), 8):
+        out.append('\t' + ', '.join('{%d, %d}' % s for s in spans[i:i + 8] or [(0, 0)]) + ',')
+    out.append('};')
+    emit_array(out, 'unsigned short', 'sprite_rows', rows, '%d', 16)
+    emit_array(out, 'unsigned int', 'sprite_masks', masks, '0x%08x', 8)
+
+    for sp in sprites:
+        if compile_scale[sp.img.name]:
+            out.append('')
+            emit_compiled(out, sp.img.name, sp.words, compile_scale[sp.img.name])
+
+    out.append('')
+    out.append('// the frame table: one entry per sprite, all headers side by side')
+    out.append('static const gl_sprite_t sprite_frames[] = {')
+    for sp in sprites:
+        img, scale = sp.img, compile_scale[sp.img.name]
+        out.append('\t{\t// %s' % img.name)
+        out.append('\t\t%d, %d,\t\t// width, height' % (img.width, img.height))
+        out.append('\t\t%d, %d, %d, %d,\t// trimmed box' % sp.trim)
+        out.append('\t\tsprite_sheet + %d, SPRITE_SHEET_STRIDE, %s,'
+                   % (sp.sheet_y * SHEET_WIDTH // 2 + sp.sheet_x // 2, sp.palette_name))
+        out.append('\t\tsprite_rows + %d, sprite_spans + %d, sprite_masks + %d,'
+                   % (sp.rows_at, sp.spans_at, sp.mask_at))
+        out.append('\t\t%d, %d,\t\t// pivot' % sp.pivot)
+        out.append('\t\t%d, %d, %d, %d,\t// collider' % sp.collider)
+        if scale:
+            out.append('\t\t%s_compiled, %d,' % (img.name, scale))
+        out.append('\t},')
+    out.append('};')
+    for i, sp in enumerate(sprites):
+        out.append('#define %s (sprite_frames[%d])' % (sp.img.name, i))
+
+
+def load_rotations(path):
+    """[(sprite, name, max degrees, steps per side)]"""
+    rotations = []
+    for num, line in enumerate(open(path), 1):
+        words = line.split('#')[0].split()
+        if not words:
+            continue
+        try:
+            if words[0] != 'rotate' or len(words) != 5:
+                raise ValueError
+            rotations.append((words[1], words[2], float(words[3]), int(words[4])))
+        except ValueError:
+            sys.exit('%s:%d: expected "rotate <sprite> <name> <max degrees> <steps>"' % (path, num))
+    return rotations
+
+
+def to_fixed(v):
+    return int(round(v * 65536))
+
+
+def fixed_mul(f, n):
+    """Round f * n for f in 16.16 fixed point and integer n."""
+    return (f * n + 0x8000) >> 16
+
+
+def rotate_image(img, name, degrees, pivot):
+    """img turned clockwise on screen by degrees about pivot, as x, y, x
+    shears of the pixel grid (Paeth). Returns the image and its pivot."""
+    theta = math.radians(degrees)
+    shear_x = to_fixed(-math.tan(theta / 2))
+    shear_y = to_fixed(math.sin(theta))
+    px, py = pivot
+    moved = {}
+    for y in range(img.height):
+        for x in range(img.width):
+            rgba = img.pixel(x, y)
+            if not rgba[3]:
+                continue
+            u, v = x - px, y - py
+            u += fixed_mul(shear_x, v)
+            v += fixed_mul(shear_y, u)
+            u += fixed_mul(shear_x, v)
+            moved[u, v] = rgba
+    if not moved:
+        return Image(name, img.width, img.height, img.rgba), pivot
+    left = min(u for u, v in moved)
+    top = min(v for u, v in moved)
+    width = max(u for u, v in moved) - left + 1
+    height = max(v for u, v in moved) - top + 1
+    rgba = [moved.get((x + left, y + top), (0, 0, 0, 0))
+            for y in range(height) for x in range(width)]
+    return Image(name, width, height, rgba), (-left, -top)
+
+
+def load_effects(path):
+    """[(name, [frame, ...])] where each frame is a {from: to} dict, '*' for the rest."""
+    effects = []
+    for num, line in enumerate(open(path), 1):
+        words = line.split('#')[0].split()
+        if not words:
+            continue
+        if words[0] == 'effect' and len(words) == 2:
+            effects.append((words[1], []))
+        elif words[0] == 'frame' and effects:
+            frame = {}
+            for pair in words[1:]:
+                src, _, dst = pair.partition('=')
+                try:
+                    frame[src if src == '*' else int(src, 16)] = int(dst, 16)
+                except ValueError:
+                    sys.exit('%s:%d: bad color pair %s' % (path, num, pair))
+            effects[-1][1].append(frame)
+        else:
+            sys.exit('%s:%d: expected "effect <name>" or "frame <from>=<to> ..."' % (path, num))
+    return effects
+
+
+def emit_effect(out, name, frames, palette):
+    if not frames:
+        sys.exit('effect %s has no frames' % name)
+    out.append('')
+    out.append('static const color_t %s_palettes[][16] = {' % name)
+    for frame in frames:
+        for src in frame:
+            if src != '*' and src not in palette:
+                sys.exit('effect %s: color %08x is not in the sprite palette' % (name, src))
+        remapped = [frame.get(c, frame.get('*', c)) for c in palette]
+        entries = [0] + remapped + [0] * (MAX_COLORS - len(palette))
+        out.append('\t{' + ', '.join('0x%08x' % c for c in entries) + '},')
+    out.append('};')
+    out.append('static const gl_effect_t %s = { %d, %s_palettes };' % (name, len(frames), name))
+
+
+def load_anims(path):
+    """[(name, loop, [sprite name, ...])]"""
+    anims = []
+    for num, line in enumerate(open(path), 1):
+        words = line.split('#')[0].split()
+        if not words:
+            continue
+        if words[0] != 'anim' or len(words) < 3:
+            sys.exit('%s:%d: expected "anim <name> [loop] <sprite> ..."' % (path, num))
+        loop = words[2] == 'loop'
+        frames = words[3:] if loop else words[2:]
+        if not frames:
+            sys.exit('%s:%d: animation %s has no frames' % (path, num, words[1]))
+        anims.append((words[1], loop, frames))
+    return anims
+
+
+def index_image(img, palette):
+    """Rows of palette indices of the whole (untrimmed) image, 0 if transparent."""
+    return [[palette.index(w) + 1 if w else 0
+             for w in (color_word(img.pixel(x, y)) for x in range(img.width))]
+            for y in range(img.height)]
+
+
+def frame_delta(old, new):
+    """(runs, indices) turning index image old into new; runs are (x, y, len)."""
+    runs, indices = [], []
+    for y, (a, b) in enumerate(zip(old, new)):
+        changed = [int(p != q) for p, q in zip(a, b)]
+        for x, n in row_spans(changed):
+            runs.append((x, y, n))
+            indices += b[x:x + n]
+    return runs, indices
+
+
+def emit_anim(out, name, loop, frames, palette):
+    first = frames[0]
+    for img in frames:
+        if (img.width, img.height) != (first.width, first.height):
+            sys.exit('animation %s: %s is not the size of %s' % (name, img.name, first.name))
+    images = [index_image(img, palette) for img in frames]
+    steps = list(zip(images, images[1:]))
+    if loop:
+        steps.append((images[-1], images[0]))
+
+    # runs and indices of all deltas go in one array each; nibbles of a
+    # delta start on a byte of their own
+    runs, packed, deltas = [], [], []
+    for old, new in steps:
+        r, idx = frame_delta(old, new)
+        deltas.append((len(r), len(runs), len(packed)))
+        runs += r
+        if len(idx) % 2:
+            idx.append(0)
+        packed += [idx[i] | (idx[i + 1] << 4) for i in range(0, len(idx), 2)]
+
+    out.append('')
+    out.append('static const anim_run_t %s_runs[] = {' % name)
+    for i in range(0, max(len(runs), 1), 6):
+        chunk = runs[i:i + 6] or [(0, 0, 0)]
+        out.append('\t' + ', '.join('{%d, %d, %d}' % r for r in chunk) + ',')
+    out.append('};')
+    emit_array(out, 'unsigned char', name + '_indices', packed, '0x%02x', 16)
+    out.append('static const anim_delta_t %s_deltas[] = {' % name)
+    for count, run, index in deltas:
+        out.append('\t{%d, %s_runs + %d, %s_indices + %d},' % (count, name, run, name, index))
+    if not deltas:
+        out.append('\t{0, %s_runs, %s_indices},' % (name, name))
+    out.append('};')
+    out.append('static const anim_t %s = { %d, %s, &%s, %s_deltas };'
+               % (name, len(frames), 'true' if loop else 'false', first.name, name))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument('-o', '--output', required=True, help='header to write')
+    parser.add_argument('--effects', help='palette effects to generate')
+    parser.add_argument('--anims', help='animations to generate')
+    parser.add_argument('--frames', help='pivots and collider boxes of the sprites')
+    parser.add_argument('--rotations', help='turned copies of sprites to generate')
+    parser.add_argument('--compile-scale', type=int, default=0, metavar='N',
+                        help='also generate straight-line draw code at scale N')
+    parser.add_argument('--compile', action='append', default=[], metavar='SPRITE',
+                        help='a sprite to generate draw code for (repeatable)')
+    parser.add_argument('dumps', nargs='+', help='GIMP C-source dumps')
+    args = parser.parse_args()
+
+    images = [load_dump(path) for path in sorted(args.dumps)]
+    anims = load_anims(args.anims) if args.anims else []
+
+    meta = load_frames(args.frames) if args.frames else {}
+
+    # turned copies join the other sprites; the unturned step is the sprite itself
+    by_name = dict((img.name, img) for img in images)
+    banks = []
+    for src, name, max_degrees, steps in load_rotations(args.rotations) if args.rotations else []:
+        if src not in by_name:
+            sys.exit('rotation %s: no sprite named %s' % (name, src))
+        img = by_name[src]
+        pivot = meta.get(src, {}).get('pivot', (img.width // 2, img.height // 2))
+        members = []
+        for i in range(-steps, steps + 1):
+            if i == 0:
+                members.append((src, 0.0))
+                continue
+            degrees = max_degrees * i / steps
+            turned, turned_pivot = rotate_image(img, '%s%d' % (name, i + steps), degrees, pivot)
+            images.append(turned)
+            meta[turned.name] = {'pivot': turned_pivot}
+            members.append((turned.name, degrees))
+        banks.append((name, src, members))
+
+    # later animation frames are only ever drawn through a player, which
+    # has them as deltas, so they get no sprite of their own
+    later_frames = set()
+    for name, loop, frames in anims:
+        later_frames.update(frames[1:])
+    for name, loop, frames in anims:
+        later_frames.discard(frames[0])
+    names = set(img.name for img in images) - later_frames
+    for name in args.compile:
+        if name not in names:
+            sys.exit('--compile: no sprite named %s' % name)
+    compile_scale = dict((img.name, args.compile_scale if img.name in args.compile else 0)
+                         for img in images)
+
+    guard = re.sub(r'\W', '_', os.path.basename(args.output)).upper()
+    out = ['/* Generated by tools/spritegen.py -- do not edit. */',
+           '#ifndef %s' % guard,
+           '#define %s' % guard,
+           '',
+           '#include "gl.h"']
+    if args.anims:
+        out.append('#include "anim.h"')
+    # one palette for everything if it fits, else one per sprite
+    shared = []
+    for img in images:
+        shared += [c for c in sprite_colors(img) if c not in shared]
+    if len(shared) <= MAX_COLORS:
+        out.append('')
+        emit_palette(out, 'sprite_palette', shared)
+    sprites = []
+    for img in images:
+        if img.name in later_frames:
+            continue
+        if len(shared) <= MAX_COLORS:
+            sprites.append(Sprite(img, shared, 'sprite_palette', meta.get(img.name, {})))
+        else:
+            own = sprite_colors(img)
+            emit_palette(out, img.name + '_palette', own)
+            sprites.append(Sprite(img, own, img.name + '_palette', meta.get(img.name, {})))
+    emit_sheet(out, sprites, compile_scale)
+    for name, src, members in banks:
+        out.append('')
+        out.append('// %s turned about its pivot, from %g to %g degrees clockwise'
+                   % (src, members[0][1], members[-1][1]))
+        out.append('#define %s_COUNT %d' % (name.upper(), len(members)))
+        out.append('static const gl_sprite_t *const %s[] = {' % name)
+        out.append('\t' + ', '.join('&' + m for m, d in members) + ',')
+        out.append('};')
+    if args.anims:
+        if len(shared) > MAX_COLORS:
+            sys.exit('animations need all sprites to share one palette')
+        by_name = dict((img.name, img) for img in images)
+        for name, loop, frames in anims:
+            for f in frames:
+                if f not in by_name:
+                    sys.exit('animation %s: no sprite named %s' % (name, f))
+            emit_anim(out, name, loop, [by_name[f] for f in frames], shared)
+    if args.effects:
+        if len(shared) > MAX_COLORS:
+            sys.exit('effects need all sprites to share one palette')
+        for name, frames in load_effects(args.effects):
+            emit_effect(out, name, frames, shared)
+    out += ['', '#endif', '']
+    with open(args.output, 'w') as f:
+        f.write('\n'.join(out))
+
+
+if __name__ == '__main__':
+    main()
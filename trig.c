@@ -0,0 +1,146 @@
+#include "trig.h"
+
+#define ITERATIONS 16
+
+// atan(2^-i) in degrees, for each step
+static const fix_t angles[ITERATIONS] = {
+	2949120, 1740967, 919879, 466945, 234379, 117304, 58666, 29335,
+	14668, 7334, 3667, 1833, 917, 458, 229, 115,
+};
+
+// the steps lengthen the vector by 1.6468; starting from 1 / 1.6468,
+// in 2.30 fixed point, leaves it unit length
+#define CORDIC_GAIN_INVERSE 652032874
+
+#define DEGREES(n) ((fix_t)(n) << FIX_SHIFT)
+
+fix_t trig_atan2(int y, int x)
+{
+	if (x == 0 && y == 0)
+		return 0;
+
+	// turn the vector into the right half, where the steps converge
+	fix_t angle = 0;
+	long long vx = x, vy = y;
+	if (vx < 0) {
+		angle = (vy < 0) ? -DEGREES(180) : DEGREES(180);
+		vx = -vx;
+		vy = -vy;
+	}
+
+	// scale the vector up for precision, leaving room for the gain
+	unsigned long long size = (unsigned long long)vx | (unsigned long long)(vy < 0 ? -vy : vy);
+	int up = 0, down = 0;
+	while ((size << up) < (1ULL << 28))
+		up++;
+	while ((size >> down) >= (1ULL << 29))
+		down++;
+	int cx = (int)((vx * (1LL << up)) >> down);
+	int cy = (int)((vy * (1LL << up)) >> down);
+
+	// turn the vector onto the x axis, adding up the angle turned
+	for (int i = 0; i < ITERATIONS; i++) {
+		int dx = cy >> i, dy = cx >> i;
+		if (cy > 0) {
+			cx += dx;
+			cy -= dy;
+			angle += angles[i];
+		} else {
+			cx -= dx;
+			cy += dy;
+			angle -= angles[i];
+		}
+	}
+	// the half turn above and the steps may overshoot the range together
+	if (angle > DEGREES(180))
+		angle -= DEGREES(360);
+	if (angle < -DEGREES(180))
+		angle += DEGREES(360);
+	return angle;
+}
+
+void trig_sincos(fix_t degrees, fix_t *sin, fix_t *cos)
+{
+	// bring the angle into -180 to 180, then -90 to 90 where the steps
+	// converge, remembering to negate for the half turn
+	if (degrees > DEGREES(180) || degrees < -DEGREES(180)) {
+		degrees %= DEGREES(360);
+		if (degrees > DEGREES(180))
+			degrees -= DEGREES(360);
+		if (degrees < -DEGREES(180))
+			degrees += DEGREES(360);
+	}
+	int sign = 1;
+	if (degrees > DEGREES(90)) {
+		degrees -= DEGREES(180);
+		sign = -1;
+	} else if (degrees < -DEGREES(90)) {
+		degrees += DEGREES(180);
+		sign = -1;
+	}
+
+	// turn the unit vector along x by the angle
+	int x = CORDIC_GAIN_INVERSE, y = 0;
+	fix_t left = degrees;
+	for (int i = 0; i < ITERATIONS; i++) {
+		int dx = y >> i, dy = x >> i;
+		if (left > 0) {
+			x -= dx;
+			y += dy;
+			left -= angles[i];
+		} else {
+			x += dx;
+			y -= dy;
+			left += angles[i];
+		}
+	}
+
+	// from 2.30 to 16.16, rounded
+	*cos = sign * ((x + (1 << 13)) >> 14);
+	*sin = sign * ((y + (1 << 13)) >> 14);
+}
+
+fix_t trig_sin(fix_t degrees)
+{
+	fix_t s, c;
+	trig_sincos(degrees, &s, &c);
+	return s;
+}
+
+fix_t trig_cos(fix_t degrees)
+{
+	fix_t s, c;
+	trig_sincos(degrees, &s, &c);
+	return c;
+}
+
+/* finds the root a bit at a time, from the highest, without dividing */
+static unsigned long long isqrt(unsigned long long x)
+{
+	unsigned long long root = 0;
+	unsigned long long bit = 1ULL << 62;
+	while (bit > x)
+		bit >>= 2;
+	while (bit) {
+		if (x >= root + bit) {
+			x -= root + bit;
+			root = (root >> 1) + bit;
+		} else {
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+	return root;
+}
+
+unsigned int trig_isqrt(unsigned int x)
+{
+	return (unsigned int)isqrt(x);
+}
+
+fix_t trig_sqrt(fix_t x)
+{
+	if (x <= 0)
+		return 0;
+	return (fix_t)isqrt((unsigned long long)x << FIX_SHIFT);
+}
@@ -0,0 +1,67 @@
+#ifndef TRIG_H
+#define TRIG_H
+
+/*
+ * Trigonometry and square roots in fixed point, for the freestanding
+ * build, which has no math library and no fast floating point.
+ *
+ * The angle functions use CORDIC: a fixed number of shift-and-add steps,
+ * each turning a vector by a smaller angle from a table, so each call
+ * costs the same bounded number of cycles with no multiply or division
+ * in the loop. Angles are in degrees.
+ */
+
+#include "fixed.h"
+
+/*
+ * `trig_atan2`
+ *
+ * @param y  the y coordinate of a vector, in any unit
+ * @param x  the x coordinate, in the same unit
+ * @return   the angle of the vector from the x axis, from -180 to 180
+ *           degrees, counterclockwise positive. 0 for the zero vector.
+ *           Within 0.01 degrees.
+ */
+fix_t trig_atan2(int y, int x);
+
+/*
+ * `trig_sincos`
+ *
+ * Compute the sine and the cosine of an angle together, within 0.0001.
+ *
+ * @param degrees  the angle
+ * @param sin      set to the sine
+ * @param cos      set to the cosine
+ */
+void trig_sincos(fix_t degrees, fix_t *sin, fix_t *cos);
+
+/*
+ * `trig_sin`
+ *
+ * @return  the sine of an angle in degrees
+ */
+fix_t trig_sin(fix_t degrees);
+
+/*
+ * `trig_cos`
+ *
+ * @return  the cosine of an angle in degrees
+ */
+fix_t trig_cos(fix_t degrees);
+
+/*
+ * `trig_isqrt`
+ *
+ * @return  the square root of x, rounded down
+ */
+unsigned int trig_isqrt(unsigned int x);
+
+/*
+ * `trig_sqrt`
+ *
+ * @param x  a fixed-point number, not negative
+ * @return   its square root, rounded down to 1/65536
+ */
+fix_t trig_sqrt(fix_t x);
+
+#endif